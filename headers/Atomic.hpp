@@ -0,0 +1,58 @@
+#ifndef __ATOMIC_HPP__
+#define __ATOMIC_HPP__
+
+/// Thin layer over the GCC __atomic builtins: the tree is C++03, so there is
+/// no <atomic>. Loads acquire, stores release, read-modify-writes are acq_rel.
+struct Atomic
+{
+    template <typename T>
+    static T load(const volatile T* address)
+    {
+        return __atomic_load_n(address, __ATOMIC_ACQUIRE);
+    }
+
+    template <typename T>
+    static T loadRelaxed(const volatile T* address)
+    {
+        return __atomic_load_n(address, __ATOMIC_RELAXED);
+    }
+
+    template <typename T>
+    static void store(volatile T* address, const T value)
+    {
+        __atomic_store_n(address, value, __ATOMIC_RELEASE);
+    }
+
+    template <typename T>
+    static void storeRelaxed(volatile T* address, const T value)
+    {
+        __atomic_store_n(address, value, __ATOMIC_RELAXED);
+    }
+
+    template <typename T>
+    static T fetchAdd(volatile T* address, const T value)
+    {
+        return __atomic_fetch_add(address, value, __ATOMIC_ACQ_REL);
+    }
+
+    template <typename T>
+    static T exchange(volatile T* address, const T value)
+    {
+        return __atomic_exchange_n(address, value, __ATOMIC_ACQ_REL);
+    }
+
+    /// on failure expected receives the current value
+    template <typename T>
+    static bool compareExchange(volatile T* address, T& expected, const T desired)
+    {
+        return __atomic_compare_exchange_n(address, &expected, desired, false,
+                                           __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+    }
+
+    static void fence()
+    {
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    }
+};
+
+#endif /// __ATOMIC_HPP__
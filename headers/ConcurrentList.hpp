@@ -0,0 +1,90 @@
+#ifndef __CONCURRENT_LIST_HPP__
+#define __CONCURRENT_LIST_HPP__
+
+#include <cstdlib>
+#include <pthread.h>
+
+/// Doubly linked list safe for concurrent use without a global lock. Every
+/// node, the two sentinels included, carries its own mutex; a link field is
+/// only read or written under the lock of the node that holds it. Locks are
+/// taken front to back with hand-over-hand coupling, so operations in
+/// different regions of the list proceed in parallel. The back end is
+/// reached from the tail sentinel by try-locking backwards and backing off
+/// on contention, which keeps the forward lock order deadlock-free.
+template <typename T>
+class ConcurrentList
+{
+public:
+    typedef size_t   size_type;
+    typedef T        value_type;
+    typedef T&       reference;
+    typedef const T& const_reference;
+
+private:
+    struct Node
+    {
+        Node(const_reference data = T(), Node* previous = NULL, Node* next = NULL)
+            : data_(data)
+            , previous_(previous)
+            , next_(next)
+        {
+            ::pthread_mutex_init(&mutex_, NULL);
+        }
+        ~Node() { ::pthread_mutex_destroy(&mutex_); }
+        void lock()    { ::pthread_mutex_lock(&mutex_); }
+        bool tryLock() { return 0 == ::pthread_mutex_trylock(&mutex_); }
+        void unlock()  { ::pthread_mutex_unlock(&mutex_); }
+        T data_;
+        Node* previous_;
+        Node* next_;
+        pthread_mutex_t mutex_;
+    };
+
+    struct EqualTo
+    {
+        explicit EqualTo(const_reference value) : value_(value) {}
+        bool operator()(const_reference data) const { return value_ == data; }
+        const_reference value_;
+    };
+
+public:
+    ConcurrentList();
+    ~ConcurrentList();
+
+    void push_front(const_reference value);
+    void push_back(const_reference value);
+    bool pop_front(reference value);
+    bool pop_back(reference value);
+    template <typename Predicate>
+    void insert(Predicate before, const_reference value);
+    bool erase(const_reference value);
+    template <typename Predicate>
+    bool erase_if(Predicate predicate);
+    bool find(const_reference value) const;
+    template <typename Predicate>
+    bool find_if(Predicate predicate, reference found) const;
+    template <typename Function>
+    Function for_each(Function function);
+
+    size_type size()  const;
+    bool      empty() const;
+    void clear();
+
+private:
+    ConcurrentList(const ConcurrentList<T>& rhv);
+    ConcurrentList<T>& operator=(const ConcurrentList<T>& rhv);
+
+    void link(Node* previous, Node* node, Node* next);
+    void unlink(Node* previous, Node* node, Node* next);
+    Node* lockLast() const;
+    static void backOff();
+
+private:
+    Node* head_;
+    Node* tail_;
+    volatile size_type size_;
+};
+
+#include "../templates/ConcurrentList.cpp"
+
+#endif /// __CONCURRENT_LIST_HPP__
@@ -0,0 +1,98 @@
+#ifndef __EPOCH_RECLAIMER_HPP__
+#define __EPOCH_RECLAIMER_HPP__
+
+#include <cstdlib>
+
+/// Epoch-based reclamation for lock-free structures. A thread pins the
+/// current global epoch with a Guard for as long as it may hold pointers
+/// into the structure. Unlinked objects are retired under the epoch read
+/// after the unlink, and deleted once the global epoch has moved two steps
+/// past it, at which point no pinned thread can still reach them.
+template <typename T>
+class EpochReclaimer
+{
+public:
+    typedef size_t size_type;
+
+private:
+    struct Record
+    {
+        Record() : state_(0), inUse_(1), next_(NULL) {}
+        volatile size_type state_;   ///< (epoch << 1) | 1 while pinned, 0 otherwise
+        volatile size_type inUse_;
+        Record* next_;
+    };
+
+    struct Retired
+    {
+        Retired(T* object, Retired* next) : object_(object), next_(next) {}
+        T* object_;
+        Retired* next_;
+    };
+
+public:
+    class Guard {
+    public:
+        explicit Guard(EpochReclaimer<T>& reclaimer);
+        ~Guard();
+
+    private:
+        Guard(const Guard& rhv);
+        Guard& operator=(const Guard& rhv);
+
+    private:
+        EpochReclaimer<T>& reclaimer_;
+        Record* record_;
+    };
+
+public:
+    /// A registered thread: the record is claimed once, so entering and
+    /// leaving a critical section costs a store and a fence, no RMW.
+    class Participant {
+    public:
+        explicit Participant(EpochReclaimer<T>& reclaimer);
+        ~Participant();
+
+        void enter();
+        void leave();
+
+    private:
+        Participant(const Participant& rhv);
+        Participant& operator=(const Participant& rhv);
+
+    private:
+        EpochReclaimer<T>& reclaimer_;
+        Record* record_;
+    };
+
+public:
+    EpochReclaimer();
+    ~EpochReclaimer();
+
+    void retire(T* object);
+    bool collect();
+    void synchronize();
+    size_type epoch()   const;
+    size_type pending() const;
+
+private:
+    EpochReclaimer(const EpochReclaimer<T>& rhv);
+    EpochReclaimer<T>& operator=(const EpochReclaimer<T>& rhv);
+
+    Record* claim();
+    void announce(Record* record);
+    void release(Record* record);
+    static void destroy(Retired* chain);
+
+private:
+    enum { BUCKETS = 3, COLLECT_PERIOD = 64 };
+
+    volatile size_type epoch_;
+    Record* volatile records_;
+    Retired* volatile retired_[BUCKETS];
+    volatile size_type pending_;
+};
+
+#include "../templates/EpochReclaimer.cpp"
+
+#endif /// __EPOCH_RECLAIMER_HPP__
@@ -0,0 +1,100 @@
+#ifndef __INDEXED_LIST_HPP__
+#define __INDEXED_LIST_HPP__
+
+#include "List.hpp"
+#include "ListHash.hpp"
+#include <functional>
+#include <vector>
+
+/// List<T> paired with a hash multimap from value to node, so that find,
+/// contains, count and remove(value) are O(1) on average. Nodes are never
+/// copied between lists, so splice, sort and merge keep the index valid.
+template <typename T, typename Hash = ListHash<T>, typename Equal = std::equal_to<T> >
+class IndexedList
+{
+public:
+    typedef typename List<T>::size_type       size_type;
+    typedef typename List<T>::value_type      value_type;
+    typedef typename List<T>::const_reference reference;
+    typedef typename List<T>::const_reference const_reference;
+    typedef typename List<T>::difference_type difference_type;
+    typedef typename List<T>::const_iterator  const_iterator;
+    typedef typename List<T>::const_iterator  iterator;
+
+private:
+    typedef typename List<T>::Node     Node;
+    typedef typename List<T>::iterator ListIterator;
+
+    struct Entry
+    {
+        Entry(Node* node, const size_t hash, Entry* next)
+            : node_(node), hash_(hash), next_(next) {}
+        Node*  node_;
+        size_t hash_;
+        Entry* next_;
+    };
+
+public:
+    explicit IndexedList(const Hash& hash = Hash(), const Equal& equal = Equal());
+    IndexedList(const IndexedList& rhv);
+    template <typename InputIterator>
+    IndexedList(InputIterator first, InputIterator last);
+    ~IndexedList();
+
+    IndexedList& operator=(const IndexedList& rhv);
+
+    const_iterator insert(const_iterator position, const_reference value);
+    const_iterator erase(const_iterator position);
+    void push_back(const_reference value);
+    void push_front(const_reference value);
+    void pop_back();
+    void pop_front();
+    const_reference front() const;
+    const_reference back()  const;
+
+    const_iterator find(const_reference value)     const;
+    bool           contains(const_reference value) const;
+    size_type      count(const_reference value)    const;
+    size_type      remove(const_reference value);
+
+    void splice(const_iterator position, IndexedList& rhv);
+    void splice(const_iterator position, IndexedList& rhv, const_iterator index);
+    void splice(const_iterator position, IndexedList& rhv, const_iterator first, const_iterator last);
+    size_type unique();
+    void merge(IndexedList& rhv);
+    template <typename BinaryPredicate>
+    void merge(IndexedList& rhv, BinaryPredicate comparison);
+    void sort();
+    template <typename BinaryPredicate>
+    void sort(BinaryPredicate comparison);
+    void reverse();
+
+    void swap(IndexedList& rhv);
+    size_type size()  const;
+    bool      empty() const;
+    void      clear();
+
+    const_iterator begin() const;
+    const_iterator end()   const;
+
+private:
+    void   indexNode(Node* node);
+    void   unindexNode(Node* node);
+    void   attach(Entry* entry);
+    Entry* detach(Node* node);
+    void   adopt(IndexedList& rhv, Node* first, Node* last);
+    Entry* lookup(const_reference value) const;
+    void   rehash(const size_type bucketCount);
+    void   dropIndex();
+
+private:
+    List<T> list_;
+    std::vector<Entry*> buckets_;
+    size_type size_;
+    Hash hash_;
+    Equal equal_;
+};
+
+#include "../templates/IndexedList.cpp"
+
+#endif /// __INDEXED_LIST_HPP__
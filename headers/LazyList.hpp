@@ -0,0 +1,123 @@
+#ifndef __LAZY_LIST_HPP__
+#define __LAZY_LIST_HPP__
+
+#include "List.hpp"
+
+/// List<T> with lazy erase: erase() only marks a node as a tombstone and
+/// iterators skip tombstones. They are unlinked and freed in batched sweeps
+/// once their share of the nodes passes the compaction threshold, or on
+/// compact_tombstones().
+template <typename T>
+class LazyList
+{
+public:
+    typedef typename List<T>::size_type       size_type;
+    typedef typename List<T>::value_type      value_type;
+    typedef typename List<T>::reference       reference;
+    typedef typename List<T>::const_reference const_reference;
+    typedef typename List<T>::pointer         pointer;
+    typedef typename List<T>::const_pointer   const_pointer;
+    typedef typename List<T>::difference_type difference_type;
+
+private:
+    struct Slot
+    {
+        Slot(const_reference value = T(), const bool dead = false) : value_(value), dead_(dead) {}
+        T value_;
+        bool dead_;
+    };
+
+    struct IsDead
+    {
+        bool operator()(const Slot& slot) const { return slot.dead_; }
+    };
+
+    typedef typename List<Slot>::iterator SlotIterator;
+                            ///====CONST_ITERATOR=====
+public:
+    class const_iterator {
+    friend class LazyList<T>;
+    public:
+        const_iterator();
+        const_iterator(const const_iterator& rhv);
+        ~const_iterator();
+
+        const_iterator& operator=(const const_iterator& rhv);
+        const_reference operator*()  const;
+        const_pointer   operator->() const;
+        const_iterator& operator++();
+        const_iterator  operator++(int);
+        const_iterator& operator--();
+        const_iterator  operator--(int);
+        bool            operator==(const const_iterator& rhv) const;
+        bool            operator!=(const const_iterator& rhv) const;
+
+    protected:
+        SlotIterator getIt() const;
+
+    private:
+        explicit const_iterator(SlotIterator it);
+
+    private:
+        SlotIterator it_;
+    };
+                                    ///====ITERATOR====
+public:
+    class iterator : public const_iterator {
+    friend class LazyList<T>;
+    public:
+        iterator();
+        iterator(const iterator& rhv);
+        ~iterator();
+
+        iterator& operator=(const iterator& rhv);
+        reference operator*()  const;
+        pointer   operator->() const;
+
+    private:
+        explicit iterator(SlotIterator it);
+    };
+
+public:
+    explicit LazyList(const double threshold = 0.25);
+
+    iterator insert(iterator position, const_reference value);
+    iterator erase(iterator position);
+    void push_back(const_reference value);
+    void push_front(const_reference value);
+    void pop_back();
+    void pop_front();
+    reference front();
+    const_reference front() const;
+    reference back();
+    const_reference back() const;
+
+    void      compact_tombstones();
+    size_type tombstones() const;
+    double    compaction_threshold() const;
+    void      set_compaction_threshold(const double threshold);
+
+    size_type size()  const;
+    bool      empty() const;
+    void      clear();
+
+    const_iterator begin() const;
+    const_iterator end()   const;
+    iterator       begin();
+    iterator       end();
+
+private:
+    SlotIterator firstLive() const;
+    SlotIterator lastLive()  const;
+    void bury(SlotIterator position);
+
+private:
+    mutable List<Slot> slots_;
+    size_type live_;
+    size_type dead_;
+    double threshold_;
+};
+
+#include "../templates/LazyList.cpp"
+
+#endif /// __LAZY_LIST_HPP__
@@ -2,11 +2,33 @@
 #define __LIST_HPP__
 
 #include <cstdlib>
+#include "ListHash.hpp"
+#include "ListCompare.hpp"
+#ifdef LIST_NODE_CACHE
+#include "NodeAllocator.hpp"
+#endif
 
+template <typename T, typename Hash, typename Equal>
+class IndexedList;
+template <typename T>
+class MpscQueue;
+template <typename T>
+class SpscQueue;
+struct ParallelPolicy;
+class Reclaimer;
+template <typename T>
+class MutationBatch;
 
 template <typename T>
 class List
 {
+    template <typename U, typename Hash, typename Equal>
+    friend class IndexedList;
+    template <typename U>
+    friend class MpscQueue;
+    template <typename U>
+    friend class SpscQueue;
+
 public:
     typedef size_t         size_type;
     typedef T              value_type;
@@ -24,6 +46,10 @@ private:
             , previous_(previous)
             , next_(next) 
         {}
+#ifdef LIST_NODE_CACHE
+        static void* operator new(size_t) { return NodeAllocator<sizeof(Node)>::allocate(); }
+        static void operator delete(void* pointer) { NodeAllocator<sizeof(Node)>::deallocate(pointer); }
+#endif
         T data_;
         Node* previous_;
         Node* next_; 
@@ -32,6 +58,8 @@ private:
 public:
     class const_iterator {
     friend class List<T>;
+    template <typename U, typename Hash, typename Equal>
+    friend class IndexedList;
     public:
         const_iterator();
         const_iterator(const const_iterator& rhv);
@@ -60,6 +88,8 @@ public:
 public:
     class iterator : public const_iterator {
     friend class List<T>;
+    template <typename U, typename Hash, typename Equal>
+    friend class IndexedList;
     public:
         iterator();
         iterator(const iterator& rhv);
@@ -116,11 +146,81 @@ public:
         explicit reverse_iterator(Node* node);
         
     };
+                                    ///====NODE_HANDLE====
+public:
+    /// Owns a node detached by extract(). Copying transfers ownership, like
+    /// std::auto_ptr, so a handle can be passed around by value in C++03.
+    class node_handle {
+    friend class List<T>;
+    public:
+        node_handle();
+        node_handle(const node_handle& rhv);
+        ~node_handle();
+
+        node_handle& operator=(const node_handle& rhv);
+        bool      empty() const;
+        reference value() const;
+
+    private:
+        explicit node_handle(Node* node);
+        Node* release() const;
+
+    private:
+        mutable Node* node_;
+    };
+
+                                    ///====CONST_PREFETCH_ITERATOR====
+public:
+    /// Forward iterator that keeps a second cursor a few nodes ahead and
+    /// prefetches it, so the next hops are already in flight while the
+    /// caller works on the current element.
+    class const_prefetch_iterator {
+    friend class List<T>;
+    public:
+        const_prefetch_iterator();
+        const_prefetch_iterator(const const_prefetch_iterator& rhv);
+        ~const_prefetch_iterator();
+
+        const_prefetch_iterator& operator=(const const_prefetch_iterator& rhv);
+        const_reference          operator*()  const;
+        Node*                    operator->() const;
+        const_prefetch_iterator& operator++();
+        const_prefetch_iterator  operator++(int);
+        bool                     operator==(const const_prefetch_iterator& rhv) const;
+        bool                     operator!=(const const_prefetch_iterator& rhv) const;
+        const_iterator           base() const;
+
+    private:
+        const_prefetch_iterator(Node* node, size_type distance);
+
+    private:
+        Node* ptr_;
+        Node* ahead_;
+    };
+
+    static const size_type PREFETCH_DISTANCE = 4; ///< nodes ahead of the cursor
+    static const size_type PREFETCH_LINES = 4;    ///< payload lines per prefetched node
+    static const size_type CACHE_LINE = 64;
 
 private:
-    template <typename  InputIt1, typename  InputIt2>
-    static bool lexicographical_compare(InputIt1 first1, InputIt1 last1,
-                                        InputIt2 first2, InputIt2 last2);
+    template <typename Compare>
+    struct NodeCompare
+    {
+        explicit NodeCompare(Compare comparison) : comparison_(comparison) {}
+        bool operator()(const Node* lhv, const Node* rhv) { return comparison_(lhv->data_, rhv->data_); }
+        Compare comparison_;
+    };
+
+    struct EqualTo
+    {
+        explicit EqualTo(const_reference value) : value_(value) {}
+        bool operator()(const_reference data) const { return value_ == data; }
+        const_reference value_;
+    };
+
+    /// Defined with the parallel algorithms, see ParallelList.hpp.
+    template <typename Predicate>
+    struct SegmentSplit;
 
 public:
     List();
@@ -138,6 +238,7 @@ public:
     bool     operator>(const List<T>& rhv)  const;
     bool     operator<=(const List<T>& rhv) const;
     bool     operator>=(const List<T>& rhv) const;
+    int      compare(const List<T>& rhv) const;
  
     iterator insert(iterator position, const_reference value);
     void insert(iterator position, const size_type size, const_reference value);
@@ -146,6 +247,8 @@ public:
     void insert(iterator position, InputIterator first, InputIterator last);
     iterator erase(iterator position);
     iterator erase(iterator first, iterator last);
+    node_handle extract(iterator position);
+    iterator insert(iterator position, node_handle node);
     void push_back(const_reference value);
     void push_front(const_reference value);
     void pop_back();
@@ -159,12 +262,15 @@ public:
     void splice(iterator position, List<T>& rhv);
     void splice(iterator position, List<T>& rhv, iterator index);
     void splice(iterator position, List<T>& rhv, iterator first, iterator last);
-    void remove(const_reference value);
+    size_type remove(const_reference value);
     template <typename Predicate>
-    void remove_if(Predicate predicate);
-    void unique();
+    size_type remove_if(Predicate predicate);
+    size_type unique();
     template <typename BinaryPredicate>
-    void unique(BinaryPredicate predicate);
+    size_type unique(BinaryPredicate predicate);
+    size_type dedupe();
+    template <typename Hash, typename BinaryPredicate>
+    size_type dedupe(Hash hash, BinaryPredicate equal);
     void merge(List<T>& rhv);
     template <typename BinaryPredicate>
     void merge(List<T>& rhv, BinaryPredicate comparison);
@@ -172,8 +278,52 @@ public:
     void sort();
     template<typename BinaryPredicate>
     void sort(BinaryPredicate comp);
+    void partial_sort(const size_type count);
+    template <typename Compare>
+    void partial_sort(const size_type count, Compare comparison);
+    void nth_element(const size_type index);
+    template <typename Compare>
+    void nth_element(size_type index, Compare comparison);
+    template <typename Predicate>
+    iterator partition(Predicate predicate);
+    template <typename Predicate>
+    iterator stable_partition(Predicate predicate);
+    template <typename Predicate>
+    size_type remove_if(const ParallelPolicy& policy, Predicate predicate);
+    template <typename Predicate>
+    iterator partition(const ParallelPolicy& policy, Predicate predicate);
+    void release_async();
+    void release_async(Reclaimer& reclaimer);
+    bool apply(const MutationBatch<T>& batch);
+    void set_union_splice(List<T>& rhv);
+    template <typename Compare>
+    void set_union_splice(List<T>& rhv, Compare comparison);
+    void set_intersection_splice(const List<T>& rhv);
+    template <typename Compare>
+    void set_intersection_splice(const List<T>& rhv, Compare comparison);
+    void set_difference_splice(const List<T>& rhv);
+    template <typename Compare>
+    void set_difference_splice(const List<T>& rhv, Compare comparison);
+
+    template <typename Function>
+    Function for_each(Function function, const size_type distance = PREFETCH_DISTANCE);
+    template <typename Function>
+    Function for_each(Function function, const size_type distance = PREFETCH_DISTANCE) const;
+    value_type accumulate(value_type init) const;
+    template <typename BinaryOperation>
+    value_type accumulate(value_type init, BinaryOperation operation) const;
+    template <typename Predicate>
+    iterator find_if(Predicate predicate);
+    template <typename Predicate>
+    const_iterator find_if(Predicate predicate) const;
 
     void resize(const size_type newSize, const_reference value = T());
+    /// Only the non-const overloads move the finger; const reads write nothing.
+    reference       at(const size_type index);
+    const_reference at(const size_type index) const;
+    iterator        seek(const size_type index);
+    const_iterator  seek(const size_type index) const;
+
     size_type size()     const; 
     size_type max_size() const;
     bool empty()         const;
@@ -187,10 +337,39 @@ public:
     iterator         end();  
     reverse_iterator rbegin();
     reverse_iterator rend();
+    const_prefetch_iterator prefetch_begin(const size_type distance = PREFETCH_DISTANCE) const;
+    const_prefetch_iterator prefetch_end() const;
+
+private:
+    template <typename InputIterator>
+    void  append(InputIterator first, InputIterator last);
+    void  append(size_type count, const_reference value);
+    void  link(Node* node, Node* position);
+    void  link(Node* first, Node* last, Node* position, const size_type count);
+    Node* unlink(Node* first, Node* last, const size_type count);
+    void discard(Node* first, Node* last, const size_type count, Node*& discarded);
+    static size_type distance(const Node* first, const Node* last);
+    template <typename Compare>
+    static Node* mergeChains(Node* left, Node* right, Compare comparison);
+    template <typename Compare>
+    static Node* medianOfThree(Node* a, Node* b, Node* c, Compare comparison);
+    static void join(Node*& first, Node*& last, Node* chainFirst, Node* chainLast);
+    static void destroy(Node* chain);
+    static void* destroyBatch(void* chain, const size_type limit);
+    Node* nodeAt(const size_type index) const;
+    Node* moveFinger(const size_type index);
+    void resetFinger();
+    static void prefetch(const Node* node);
+    template <typename Predicate>
+    size_type splitSegments(const ParallelPolicy& policy, Predicate predicate, bool discardMatched,
+                            Node*& matchedFirst, Node*& matchedLast, Node*& restFirst, Node*& restLast);
 
 private:
     Node* begin_;
     Node* end_;
+    Node*     finger_;      ///< last node reached by a non-const at()/seek()
+    size_type fingerIndex_;
+    size_type size_;
 };
 
 #include "../templates/List.cpp"
@@ -0,0 +1,28 @@
+#ifndef __LIST_COMPARE_HPP__
+#define __LIST_COMPARE_HPP__
+
+#include <string>
+
+template <typename T>
+struct ListCompare
+{
+    int operator()(const T& lhv, const T& rhv) const
+    {
+        if (lhv < rhv) return -1;
+        if (rhv < lhv) return 1;
+        return 0;
+    }
+};
+
+/// one traits-level memcmp per element instead of two operator< calls
+template <typename Char, typename Traits, typename Allocator>
+struct ListCompare<std::basic_string<Char, Traits, Allocator> >
+{
+    int operator()(const std::basic_string<Char, Traits, Allocator>& lhv,
+                   const std::basic_string<Char, Traits, Allocator>& rhv) const
+    {
+        return lhv.compare(rhv);
+    }
+};
+
+#endif /// __LIST_COMPARE_HPP__
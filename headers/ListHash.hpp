@@ -0,0 +1,154 @@
+#ifndef __LIST_HASH_HPP__
+#define __LIST_HASH_HPP__
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+
+/// Word-size dependent constants and mixing; the primary template is the
+/// 64-bit size_t one, ListHashing picks the right one for the platform.
+template <size_t Bytes>
+struct ListHashBits
+{
+    static size_t fnvOffset() { return wide(0xcbf29ce4UL, 0x84222325UL); }
+    static size_t fnvPrime()  { return wide(0x00000100UL, 0x000001b3UL); }
+
+    /// splitmix64 finalizer
+    static size_t scatter(size_t hash)
+    {
+        hash ^= hash >> 30;
+        hash *= wide(0xbf58476dUL, 0x1ce4e5b9UL);
+        hash ^= hash >> 27;
+        hash *= wide(0x94d049bbUL, 0x133111ebUL);
+        hash ^= hash >> 31;
+        return hash;
+    }
+
+    static size_t wide(const unsigned long high, const unsigned long low)
+    {
+        return (static_cast<size_t>(high) << (Bytes * 4)) | static_cast<size_t>(low);
+    }
+};
+
+template <>
+struct ListHashBits<4>
+{
+    static size_t fnvOffset() { return 2166136261UL; }
+    static size_t fnvPrime()  { return 16777619UL; }
+
+    static size_t scatter(size_t hash)
+    {
+        hash ^= hash >> 16;
+        hash *= 0x45d9f3bUL;
+        hash ^= hash >> 16;
+        return hash;
+    }
+};
+
+/// scatter() spreads weak hashes (e.g. identity on integers) before masking
+/// to a power of two.
+typedef ListHashBits<sizeof(size_t)> ListHashing;
+
+template <typename T>
+struct ListHash;
+
+#define LIST_HASH_INTEGRAL(Type)                                   \
+template <>                                                        \
+struct ListHash<Type>                                              \
+{                                                                  \
+    size_t operator()(const Type value) const                      \
+    {                                                              \
+        return static_cast<size_t>(value);                         \
+    }                                                              \
+};
+
+LIST_HASH_INTEGRAL(bool)
+LIST_HASH_INTEGRAL(char)
+LIST_HASH_INTEGRAL(signed char)
+LIST_HASH_INTEGRAL(unsigned char)
+LIST_HASH_INTEGRAL(wchar_t)
+LIST_HASH_INTEGRAL(short)
+LIST_HASH_INTEGRAL(unsigned short)
+LIST_HASH_INTEGRAL(int)
+LIST_HASH_INTEGRAL(unsigned int)
+LIST_HASH_INTEGRAL(long)
+LIST_HASH_INTEGRAL(unsigned long)
+
+#undef LIST_HASH_INTEGRAL
+
+/// Folds the high half in, so a 32-bit size_t still sees every bit.
+template <>
+struct ListHash<unsigned long long>
+{
+    size_t operator()(const unsigned long long value) const
+    {
+        return static_cast<size_t>(value ^ (value >> 32));
+    }
+};
+
+template <>
+struct ListHash<long long>
+{
+    size_t operator()(const long long value) const
+    {
+        return ListHash<unsigned long long>()(static_cast<unsigned long long>(value));
+    }
+};
+
+/// Hashes the bit pattern; -0.0 is folded onto 0.0 because they compare equal.
+template <>
+struct ListHash<double>
+{
+    size_t operator()(const double value) const
+    {
+        const double normalized = (0.0 == value ? 0.0 : value);
+        unsigned long long bits = 0;
+        std::memcpy(&bits, &normalized, sizeof(normalized));
+        return ListHash<unsigned long long>()(bits);
+    }
+};
+
+template <>
+struct ListHash<float>
+{
+    size_t operator()(const float value) const
+    {
+        return ListHash<double>()(value);
+    }
+};
+
+/// Equal long doubles round to the same double.
+template <>
+struct ListHash<long double>
+{
+    size_t operator()(const long double value) const
+    {
+        return ListHash<double>()(static_cast<double>(value));
+    }
+};
+
+template <typename T>
+struct ListHash<T*>
+{
+    size_t operator()(const T* pointer) const
+    {
+        return reinterpret_cast<size_t>(pointer);
+    }
+};
+
+template <typename Char, typename Traits, typename Allocator>
+struct ListHash<std::basic_string<Char, Traits, Allocator> >
+{
+    size_t operator()(const std::basic_string<Char, Traits, Allocator>& value) const
+    {
+        /// FNV-1a
+        size_t hash = ListHashing::fnvOffset();
+        for (size_t i = 0; i < value.size(); ++i) {
+            hash ^= static_cast<size_t>(value[i]);
+            hash *= ListHashing::fnvPrime();
+        }
+        return hash;
+    }
+};
+
+#endif /// __LIST_HASH_HPP__
@@ -0,0 +1,65 @@
+#ifndef __LOCK_FREE_LIST_HPP__
+#define __LOCK_FREE_LIST_HPP__
+
+#include "EpochReclaimer.hpp"
+#include <cstdlib>
+#include <functional>
+
+/// Sorted set on a lock-free singly linked list (Harris, with Michael's
+/// traversal). erase() first marks the low bit of the victim's next_ pointer,
+/// which logically deletes it and freezes its successor link; any traversal
+/// that meets a marked node snips it out with a CAS on the predecessor.
+/// contains() never writes and never retries. Unlinked nodes go through an
+/// EpochReclaimer, so a node is freed only after no thread can still be
+/// standing on it.
+template <typename T, typename Compare = std::less<T> >
+class LockFreeList
+{
+public:
+    typedef size_t   size_type;
+    typedef T        value_type;
+    typedef const T& const_reference;
+
+private:
+    struct Node
+    {
+        Node(const_reference data = T(), Node* next = NULL)
+            : data_(data)
+            , next_(next)
+        {}
+        T data_;
+        Node* volatile next_;   ///< low bit set once the node is erased
+    };
+
+    typedef typename EpochReclaimer<Node>::Guard Guard;
+
+public:
+    explicit LockFreeList(Compare comparison = Compare());
+    ~LockFreeList();
+
+    bool insert(const_reference value);
+    bool erase(const_reference value);
+    bool contains(const_reference value) const;
+
+    size_type size()  const;
+    bool      empty() const;
+
+private:
+    LockFreeList(const LockFreeList<T, Compare>& rhv);
+    LockFreeList<T, Compare>& operator=(const LockFreeList<T, Compare>& rhv);
+
+    bool search(const_reference value, Node*& previous, Node*& current);
+    static bool  isMarked(const Node* next);
+    static Node* mark(const Node* next);
+    static Node* unmark(const Node* next);
+
+private:
+    Node* head_;
+    Compare comparison_;
+    volatile size_type size_;
+    mutable EpochReclaimer<Node> reclaimer_;
+};
+
+#include "../templates/LockFreeList.cpp"
+
+#endif /// __LOCK_FREE_LIST_HPP__
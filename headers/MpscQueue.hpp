@@ -0,0 +1,75 @@
+#ifndef __MPSC_QUEUE_HPP__
+#define __MPSC_QUEUE_HPP__
+
+#include "List.hpp"
+
+/// Unbounded multi-producer single-consumer queue (Vyukov's intrusive
+/// design) whose elements are List<T> nodes. A push is one exchange on the
+/// tail and one store, with no CAS loop. The consumer owns every node it
+/// takes, so drain_into() hands a whole batch to a List<T> without copying
+/// or allocating.
+///
+/// Nodes released by pop() go to a shared free stack. Producers that push
+/// through a Producer handle take that stack over in one exchange and
+/// reuse it, so a steady stream through handles does not allocate. Plain
+/// push() always allocates.
+///
+/// pop() may briefly report empty while a producer sits between its
+/// exchange and its link store.
+template <typename T>
+class MpscQueue
+{
+public:
+    typedef typename List<T>::size_type       size_type;
+    typedef typename List<T>::value_type      value_type;
+    typedef typename List<T>::reference       reference;
+    typedef typename List<T>::const_reference const_reference;
+
+private:
+    typedef typename List<T>::Node Node;
+
+public:
+    class Producer {
+    public:
+        explicit Producer(MpscQueue<T>& queue);
+        ~Producer();
+
+        void push(const_reference value);
+
+    private:
+        Producer(const Producer& rhv);
+        Producer& operator=(const Producer& rhv);
+
+    private:
+        MpscQueue<T>& queue_;
+        Node* cache_;
+    };
+
+public:
+    MpscQueue();
+    ~MpscQueue();
+
+    void push(const_reference value);
+    bool pop(reference value);
+    size_type drain_into(List<T>& list);
+    bool empty() const;
+
+private:
+    MpscQueue(const MpscQueue<T>& rhv);
+    MpscQueue<T>& operator=(const MpscQueue<T>& rhv);
+
+    void  enqueue(Node* node);
+    Node* dequeue();
+    void  recycle(Node* first, Node* last);
+    static void destroy(Node* chain);
+
+private:
+    Node* head_;              ///< consumer side
+    Node* volatile tail_;     ///< producer side
+    Node* stub_;
+    Node* volatile free_;     ///< recycled nodes, linked through next_
+};
+
+#include "../templates/MpscQueue.cpp"
+
+#endif /// __MPSC_QUEUE_HPP__
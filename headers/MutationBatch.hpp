@@ -0,0 +1,51 @@
+#ifndef __MUTATION_BATCH_HPP__
+#define __MUTATION_BATCH_HPP__
+
+#include "List.hpp"
+#include <vector>
+
+/// Inserts and erases collected for List<T>::apply(). An index names the
+/// element at that position before the batch is applied, an iterator names
+/// its node; size() or end() means "at the back". Inserts at one position
+/// keep the order they were added in and land before the element there.
+/// Iterators must stay valid until apply(). A batch with an index past the
+/// end, or an erase of end(), is rejected by apply() as a whole.
+template <typename T>
+class MutationBatch
+{
+    friend class List<T>;
+public:
+    typedef typename List<T>::size_type size_type;
+    typedef typename List<T>::iterator  iterator;
+
+private:
+    struct Operation
+    {
+        size_type index_;
+        iterator position_;
+        size_type value_;
+        bool pinned_;   ///< keyed by position_ rather than index_
+        bool erase_;
+    };
+
+public:
+    void insert(const size_type index, const T& value);
+    void insert(iterator position, const T& value);
+    void erase(const size_type index);
+    void erase(iterator position);
+
+    size_type size() const;
+    bool empty() const;
+    void clear();
+
+private:
+    void add(const size_type index, iterator position, const bool pinned, const bool erase);
+
+private:
+    std::vector<Operation> operations_;
+    std::vector<T> values_;
+};
+
+#include "../templates/MutationBatch.cpp"
+
+#endif /// __MUTATION_BATCH_HPP__
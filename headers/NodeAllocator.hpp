@@ -0,0 +1,73 @@
+#ifndef __NODE_ALLOCATOR_HPP__
+#define __NODE_ALLOCATOR_HPP__
+
+#include <cstdlib>
+#include <pthread.h>
+
+/// Fixed-size block allocator with one cache per thread. A block remembers
+/// the cache that carved it. Freeing on the owning thread is a push onto a
+/// private free list. Freeing on any other thread collects blocks in a
+/// small outgoing batch per owner, which is handed over with one CAS onto
+/// the owner's remote list. The owner takes that list back in one exchange
+/// when its private list runs dry. The global lock is only taken when a
+/// thread gets or gives up its cache. Caches of finished threads are
+/// adopted by new ones, and memory is kept for reuse, not returned.
+///
+/// List<T> nodes use it when LIST_NODE_CACHE is defined.
+template <size_t Size>
+class NodeAllocator
+{
+public:
+    enum { BATCH = 32, SLAB = 64 };
+
+    static void* allocate();
+    static void  deallocate(void* pointer);
+
+private:
+    struct Cache;
+
+    struct Block
+    {
+        Cache* owner_;
+        Block* next_;   ///< link while the block is free
+    };
+
+    struct Slab
+    {
+        Slab* next_;
+        Slab* padding_;
+    };
+
+    struct Cache
+    {
+        Block* free_;
+        Block* volatile remote_;
+        Cache* outgoingOwner_;
+        Block* outgoingFirst_;
+        Block* outgoingLast_;
+        size_t outgoingCount_;
+        Slab* slabs_;
+        Cache* next_;   ///< registry of all caches, or of orphans
+    };
+
+    enum { PAYLOAD = (Size + 15) / 16 * 16, BLOCK = sizeof(Block) + PAYLOAD };
+
+private:
+    static Cache* local();
+    static void   refill(Cache* cache);
+    static void   flush(Cache* cache);
+    static void   release(void* cache);
+    static void   createKey();
+
+private:
+    static __thread Cache* local_;
+    static pthread_once_t  once_;
+    static pthread_key_t   key_;
+    static pthread_mutex_t registry_;
+    static Cache* caches_;
+    static Cache* orphans_;
+};
+
+#include "../templates/NodeAllocator.cpp"
+
+#endif /// __NODE_ALLOCATOR_HPP__
@@ -0,0 +1,108 @@
+#ifndef __ORIENTED_LIST_HPP__
+#define __ORIENTED_LIST_HPP__
+
+#include "List.hpp"
+
+/// List<T> viewed through a direction bit: reverse() is O(1) and iteration,
+/// front/back, push/pop, insert/erase and splice all follow the current
+/// orientation. normalize() applies the orientation to the links.
+template <typename T>
+class OrientedList
+{
+public:
+    typedef typename List<T>::size_type       size_type;
+    typedef typename List<T>::value_type      value_type;
+    typedef typename List<T>::reference       reference;
+    typedef typename List<T>::const_reference const_reference;
+    typedef typename List<T>::pointer         pointer;
+    typedef typename List<T>::const_pointer   const_pointer;
+    typedef typename List<T>::difference_type difference_type;
+                            ///====CONST_ITERATOR=====
+public:
+    class const_iterator {
+    friend class OrientedList<T>;
+    public:
+        const_iterator();
+        const_iterator(const const_iterator& rhv);
+        ~const_iterator();
+
+        const_iterator& operator=(const const_iterator& rhv);
+        const_reference operator*()  const;
+        const_pointer   operator->() const;
+        const_iterator& operator++();
+        const_iterator  operator++(int);
+        const_iterator& operator--();
+        const_iterator  operator--(int);
+        bool            operator==(const const_iterator& rhv) const;
+        bool            operator!=(const const_iterator& rhv) const;
+
+    protected:
+        typename List<T>::iterator getIt() const;
+
+    private:
+        const_iterator(List<T>* owner, typename List<T>::iterator it, const bool reversed);
+
+    private:
+        List<T>* owner_;
+        typename List<T>::iterator it_;
+        bool reversed_;
+    };
+                                    ///====ITERATOR====
+public:
+    class iterator : public const_iterator {
+    friend class OrientedList<T>;
+    public:
+        iterator();
+        iterator(const iterator& rhv);
+        ~iterator();
+
+        iterator& operator=(const iterator& rhv);
+        reference operator*()  const;
+        pointer   operator->() const;
+
+    private:
+        iterator(List<T>* owner, typename List<T>::iterator it, const bool reversed);
+    };
+
+public:
+    OrientedList();
+    explicit OrientedList(const List<T>& list);
+
+    void reverse();
+    void normalize();
+    bool reversed() const;
+
+    iterator insert(iterator position, const_reference value);
+    iterator erase(iterator position);
+    void push_back(const_reference value);
+    void push_front(const_reference value);
+    void pop_back();
+    void pop_front();
+    reference front();
+    const_reference front() const;
+    reference back();
+    const_reference back() const;
+
+    void splice(iterator position, OrientedList<T>& rhv);
+    void splice(iterator position, OrientedList<T>& rhv, iterator index);
+
+    size_type size()  const;
+    bool      empty() const;
+    void      clear();
+
+    const_iterator begin() const;
+    const_iterator end()   const;
+    iterator       begin();
+    iterator       end();
+
+private:
+    typename List<T>::iterator physical(iterator position);
+
+private:
+    List<T> list_;
+    bool reversed_;
+};
+
+#include "../templates/OrientedList.cpp"
+
+#endif /// __ORIENTED_LIST_HPP__
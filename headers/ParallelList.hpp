@@ -0,0 +1,65 @@
+#ifndef __PARALLEL_LIST_HPP__
+#define __PARALLEL_LIST_HPP__
+
+#include "List.hpp"
+#include "ThreadPool.hpp"
+
+/// Execution policy for the parallel list algorithms: the pool to run on and
+/// the fewest elements worth a segment of their own.
+struct ParallelPolicy
+{
+    explicit ParallelPolicy(ThreadPool* pool = NULL, const size_t grain = 4096)
+        : pool_(pool)
+        , grain_(grain)
+    {}
+    ParallelPolicy on(ThreadPool& pool) const { return ParallelPolicy(&pool, grain_); }
+    ParallelPolicy with_grain(const size_t grain) const { return ParallelPolicy(pool_, grain); }
+    ThreadPool& pool() const { return pool_ != NULL ? *pool_ : ThreadPool::instance(); }
+
+    ThreadPool* pool_;
+    size_t grain_;
+};
+
+static const ParallelPolicy par = ParallelPolicy();
+
+/// Read-only algorithms over a List split into segments. One sampling pass
+/// over the links records every grain-th position and picks the segment
+/// bounds from those samples. The segments then run as tasks on the pool's
+/// work-stealing deques, and results are combined in list order. The walk
+/// stays serial, because a linked list cannot be indexed, so these pay off
+/// when the per-element work outweighs a pointer hop. Lists of at most one
+/// grain run on the calling thread.
+template <typename T, typename Predicate>
+typename List<T>::size_type
+count_if(const ParallelPolicy& policy, const List<T>& list, Predicate predicate);
+
+/// The first match in list order, as with the sequential algorithm.
+template <typename T, typename Predicate>
+typename List<T>::const_iterator
+find_if(const ParallelPolicy& policy, const List<T>& list, Predicate predicate);
+
+template <typename T, typename Predicate>
+typename List<T>::iterator
+find_if(const ParallelPolicy& policy, List<T>& list, Predicate predicate);
+
+template <typename T>
+T
+accumulate(const ParallelPolicy& policy, const List<T>& list, T init);
+
+/// operation must be associative; segments are folded left to right.
+template <typename T, typename BinaryOperation>
+T
+accumulate(const ParallelPolicy& policy, const List<T>& list, T init, BinaryOperation operation);
+
+/// Each segment works on its own copy of function.
+template <typename T, typename Function>
+void
+for_each(const ParallelPolicy& policy, List<T>& list, Function function);
+
+template <typename T, typename Function>
+void
+for_each(const ParallelPolicy& policy, const List<T>& list, Function function);
+
+#include "../templates/ParallelList.cpp"
+
+#endif /// __PARALLEL_LIST_HPP__
@@ -0,0 +1,153 @@
+#ifndef __RANKED_LIST_HPP__
+#define __RANKED_LIST_HPP__
+
+#include <cstdlib>
+
+template <typename T, typename Compare>
+class SortedList;
+
+/// Doubly linked list with an indexable skip index on top of the links:
+/// at(), iterator_at(), index_of(), distance(), insert(), erase() and
+/// splice() of one element or of a range are expected O(log n). Only the
+/// member distance() is fast; std::distance on the iterators walks O(n).
+template <typename T>
+class RankedList
+{
+    template <typename U, typename Compare>
+    friend class SortedList;
+
+public:
+    typedef size_t         size_type;
+    typedef T              value_type;
+    typedef T&             reference;
+    typedef const T&       const_reference;
+    typedef T*             pointer;
+    typedef const T*       const_pointer;
+    typedef std::ptrdiff_t difference_type;
+                                            ///====NODE===
+private:
+    enum { MAX_LEVEL = 16 };
+
+    struct Node;
+    struct Link
+    {
+        Node*     next_;
+        size_type width_;
+    };
+
+    struct Node
+    {
+        Node(const_reference data = T(), const size_type height = 1);
+        ~Node();
+        T data_;
+        Node* previous_;
+        Node* next_;
+        size_type height_;
+        Link* levels_; ///< levels 1 .. height_ - 1, next_ is level 0
+    };
+                            ///====CONST_ITERATOR=====
+public:
+    class const_iterator {
+    friend class RankedList<T>;
+    template <typename U, typename Compare>
+    friend class SortedList;
+    public:
+        const_iterator();
+        const_iterator(const const_iterator& rhv);
+        ~const_iterator();
+
+        const_iterator& operator=(const const_iterator& rhv);
+        const_reference operator*()  const;
+        const_pointer   operator->() const;
+        const_iterator& operator++();
+        const_iterator  operator++(int);
+        const_iterator& operator--();
+        const_iterator  operator--(int);
+        bool            operator==(const const_iterator& rhv) const;
+        bool            operator!=(const const_iterator& rhv) const;
+
+    protected:
+        Node* getPtr() const;
+
+    private:
+        explicit const_iterator(Node* node);
+
+    private:
+        Node* ptr_;
+    };
+                                    ///====ITERATOR====
+public:
+    class iterator : public const_iterator {
+    friend class RankedList<T>;
+    public:
+        iterator();
+        iterator(const iterator& rhv);
+        ~iterator();
+
+        iterator& operator=(const iterator& rhv);
+        reference operator*()  const;
+        pointer   operator->() const;
+
+    private:
+        explicit iterator(Node* node);
+    };
+
+public:
+    RankedList();
+    RankedList(const RankedList<T>& rhv);
+    template <typename InputIterator>
+    RankedList(InputIterator first, InputIterator last);
+    ~RankedList();
+
+    RankedList<T>& operator=(const RankedList<T>& rhv);
+
+    reference       at(const size_type index);
+    const_reference at(const size_type index) const;
+    iterator        iterator_at(const size_type index);
+    const_iterator  iterator_at(const size_type index) const;
+    size_type       index_of(const_iterator position) const;
+    difference_type distance(const_iterator first, const_iterator last) const;
+
+    iterator insert(iterator position, const_reference value);
+    iterator erase(iterator position);
+    void push_back(const_reference value);
+    void push_front(const_reference value);
+    void pop_back();
+    void pop_front();
+    reference front();
+    const_reference front() const;
+    reference back();
+    const_reference back() const;
+
+    void swap(RankedList<T>& rhv);
+    void splice(iterator position, RankedList<T>& rhv, iterator index);
+    void splice(iterator position, RankedList<T>& rhv, iterator first, iterator last);
+
+    size_type size()  const;
+    bool      empty() const;
+    void      clear();
+
+    const_iterator begin() const;
+    const_iterator end()   const;
+    iterator       begin();
+    iterator       end();
+
+private:
+    size_type rankOf(const Node* node) const;
+    Node* findByRank(const size_type rank) const;
+    void findPredecessors(const size_type rank, Node** update, size_type* updateRank) const;
+    void link(Node* node, Node* position);
+    void link(Node* node, Node* position, const size_type rank,
+              Node* const* update, const size_type* updateRank);
+    void unlink(Node* node);
+    size_type randomHeight();
+
+private:
+    Node* head_; ///< sentinel: before begin() and end() at once
+    size_type size_;
+    unsigned int seed_;
+};
+
+#include "../templates/RankedList.cpp"
+
+#endif /// __RANKED_LIST_HPP__
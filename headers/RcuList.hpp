@@ -0,0 +1,127 @@
+#ifndef __RCU_LIST_HPP__
+#define __RCU_LIST_HPP__
+
+#include "EpochReclaimer.hpp"
+#include <cstdlib>
+#include <pthread.h>
+
+/// Read-mostly list in the RCU style. Readers walk the chain with plain
+/// acquire loads. A registered Reader marks its critical section with one
+/// store and fence on the way in and one store on the way out, and takes
+/// no lock and does no RMW. Writers are serialized by a mutex. They
+/// build each change off to the side and publish it with a single release
+/// store of a next_ pointer, so a reader sees either the old or the new
+/// chain and never a partial one. Unlinked nodes are retired to an
+/// EpochReclaimer and freed after a grace period.
+template <typename T>
+class RcuList
+{
+public:
+    typedef size_t   size_type;
+    typedef T        value_type;
+    typedef T&       reference;
+    typedef const T& const_reference;
+
+private:
+    struct Node
+    {
+        Node(const_reference data = T(), Node* next = NULL)
+            : data_(data)
+            , next_(next)
+        {}
+        T data_;
+        Node* volatile next_;
+    };
+
+    struct EqualTo
+    {
+        explicit EqualTo(const_reference value) : value_(value) {}
+        bool operator()(const_reference data) const { return value_ == data; }
+        const_reference value_;
+    };
+
+    typedef typename EpochReclaimer<Node>::Guard Guard;
+
+public:
+    /// One per reader thread. Sections do not nest.
+    class Reader {
+    public:
+        explicit Reader(const RcuList<T>& list);
+        ~Reader();
+
+        void lock();
+        void unlock();
+
+    private:
+        Reader(const Reader& rhv);
+        Reader& operator=(const Reader& rhv);
+
+    private:
+        typename EpochReclaimer<Node>::Participant participant_;
+    };
+
+    /// Valid only inside a read-side section or on the writer side.
+    class const_iterator {
+    friend class RcuList<T>;
+    public:
+        const_iterator();
+        const_iterator(const const_iterator& rhv);
+        ~const_iterator();
+
+        const_iterator& operator=(const const_iterator& rhv);
+        const_reference operator*()  const;
+        const T*        operator->() const;
+        const_iterator& operator++();
+        const_iterator  operator++(int);
+        bool            operator==(const const_iterator& rhv) const;
+        bool            operator!=(const const_iterator& rhv) const;
+
+    private:
+        explicit const_iterator(Node* node);
+
+    private:
+        Node* ptr_;
+    };
+
+public:
+    RcuList();
+    ~RcuList();
+
+    void push_front(const_reference value);
+    void push_back(const_reference value);
+    template <typename Predicate>
+    void insert(Predicate before, const_reference value);
+    bool erase(const_reference value);
+    template <typename Predicate>
+    bool erase_if(Predicate predicate);
+    template <typename Predicate>
+    bool replace_if(Predicate predicate, const_reference value);
+    void clear();
+    void synchronize();
+
+    size_type size()  const;
+    bool      empty() const;
+
+    const_iterator begin() const;
+    const_iterator end()   const;
+
+private:
+    RcuList(const RcuList<T>& rhv);
+    RcuList<T>& operator=(const RcuList<T>& rhv);
+
+    void lockWriter();
+    void unlockWriter();
+    void publish(Node* previous, Node* node);
+    void retire(Node* previous, Node* node);
+
+private:
+    Node* head_;
+    Node* tail_;                 ///< writer side: last node, head_ when empty
+    volatile size_type size_;
+    pthread_mutex_t writer_;
+    mutable EpochReclaimer<Node> reclaimer_;
+};
+
+#include "../templates/RcuList.cpp"
+
+#endif /// __RCU_LIST_HPP__
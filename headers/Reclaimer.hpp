@@ -0,0 +1,61 @@
+#ifndef __RECLAIMER_HPP__
+#define __RECLAIMER_HPP__
+
+#include "List.hpp"
+#include <cstdlib>
+#include <deque>
+#include <pthread.h>
+
+/// Background thread that frees detached node chains. Each chain is freed
+/// a bounded batch at a time, and the queue lock is dropped between
+/// batches, so handing a chain over never waits behind a long free and
+/// several chains make progress in turn. Destructors of the elements run
+/// on the reclaimer thread.
+class Reclaimer
+{
+public:
+    typedef size_t size_type;
+    /// Frees up to limit links of chain and returns the rest, NULL when done.
+    typedef void* (*Destroy)(void* chain, const size_type limit);
+
+private:
+    struct Job
+    {
+        Job(void* chain = NULL, Destroy destroy = NULL)
+            : chain_(chain)
+            , destroy_(destroy)
+        {}
+        void* chain_;
+        Destroy destroy_;
+    };
+
+public:
+    explicit Reclaimer(const size_type batch = 4096);
+    ~Reclaimer();
+
+    static Reclaimer& instance();
+    void retire(void* chain, Destroy destroy);
+    void drain();
+    size_type pending() const;
+
+private:
+    Reclaimer(const Reclaimer& rhv);
+    Reclaimer& operator=(const Reclaimer& rhv);
+
+    void work();
+    static void* start(void* argument);
+
+private:
+    std::deque<Job> jobs_;
+    size_type busy_;
+    size_type batch_;
+    bool stopping_;
+    mutable pthread_mutex_t mutex_;
+    pthread_cond_t wake_;
+    pthread_cond_t idle_;
+    pthread_t thread_;
+};
+
+#include "../templates/Reclaimer.cpp"
+
+#endif /// __RECLAIMER_HPP__
@@ -0,0 +1,100 @@
+#ifndef __SHARDED_LIST_HPP__
+#define __SHARDED_LIST_HPP__
+
+#include "List.hpp"
+#include <vector>
+#include <pthread.h>
+
+/// Append-mostly list split into per-thread shards. Every thread is given a
+/// home shard on its first push_back and always appends there, so with at
+/// least as many shards as appending threads no two threads share a tail or
+/// a lock. Each shard is padded to its own cache lines and keeps its own
+/// count, so size() takes no lock. drain_into() concatenates the shards
+/// with one O(1) splice each, and iteration walks them in shard order, each
+/// in its own append order. Iteration is only safe while nobody appends.
+/// Thread numbers are handed back when a thread exits and the lowest free
+/// one is reused, so live threads stay on distinct shards while there are
+/// no more of them than shards.
+template <typename T>
+class ShardedList
+{
+public:
+    typedef typename List<T>::size_type       size_type;
+    typedef typename List<T>::value_type      value_type;
+    typedef typename List<T>::const_reference const_reference;
+
+private:
+    enum { CACHE_LINE = 64 };
+
+    struct Shard
+    {
+        Shard() : list_(), count_(0) { ::pthread_mutex_init(&mutex_, NULL); }
+        ~Shard() { ::pthread_mutex_destroy(&mutex_); }
+        pthread_mutex_t mutex_;
+        List<T> list_;
+        volatile size_type count_;   ///< written under mutex_, read without it
+        char padding_[CACHE_LINE];
+    };
+
+public:
+    class const_iterator {
+    friend class ShardedList<T>;
+    public:
+        const_iterator();
+        const_iterator(const const_iterator& rhv);
+        ~const_iterator();
+
+        const_iterator& operator=(const const_iterator& rhv);
+        const_reference operator*()  const;
+        const T*        operator->() const;
+        const_iterator& operator++();
+        const_iterator  operator++(int);
+        bool            operator==(const const_iterator& rhv) const;
+        bool            operator!=(const const_iterator& rhv) const;
+
+    private:
+        const_iterator(const ShardedList<T>* owner, size_type shard);
+        void skipEmpty();
+
+    private:
+        const ShardedList<T>* owner_;
+        size_type shard_;
+        typename List<T>::const_iterator position_;
+    };
+
+public:
+    explicit ShardedList(const size_type shards = 0);
+    ~ShardedList();
+
+    void push_back(const_reference value);
+    size_type drain_into(List<T>& list);
+    void clear();
+
+    size_type size()   const;
+    bool      empty()  const;
+    size_type shards() const;
+
+    const_iterator begin() const;
+    const_iterator end()   const;
+
+private:
+    ShardedList(const ShardedList<T>& rhv);
+    ShardedList<T>& operator=(const ShardedList<T>& rhv);
+
+    static size_type threadIndex();
+    static void releaseIndex(void* index);
+    static void createKey();
+
+private:
+    Shard* shards_;
+    size_type shardCount_;
+    static size_type threads_;
+    static std::vector<size_type>* freeIndices_;   ///< min-heap
+    static pthread_mutex_t indices_;
+    static pthread_once_t once_;
+    static pthread_key_t key_;
+};
+
+#include "../templates/ShardedList.cpp"
+
+#endif /// __SHARDED_LIST_HPP__
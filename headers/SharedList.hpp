@@ -0,0 +1,65 @@
+#ifndef __SHARED_LIST_HPP__
+#define __SHARED_LIST_HPP__
+
+#include "List.hpp"
+
+/// Copy-on-write handle to a List<T>: copies share one reference-counted
+/// node chain and the first mutation through a shared handle detaches a
+/// private copy. The count is atomic, so read-only snapshots may be handed
+/// to other threads; a single handle is not itself thread-safe.
+template <typename T>
+class SharedList
+{
+public:
+    typedef typename List<T>::size_type       size_type;
+    typedef typename List<T>::value_type      value_type;
+    typedef typename List<T>::const_reference const_reference;
+    typedef typename List<T>::const_iterator  const_iterator;
+
+private:
+    struct Block
+    {
+        Block() : list_(), references_(1) {}
+        explicit Block(const List<T>& list) : list_(list), references_(1) {}
+        List<T> list_;
+        volatile size_type references_;
+    };
+
+public:
+    SharedList();
+    explicit SharedList(const List<T>& list);
+    SharedList(const SharedList<T>& rhv);
+    ~SharedList();
+
+    SharedList<T>& operator=(const SharedList<T>& rhv);
+
+    const List<T>& list() const;
+    List<T>& mutate();
+
+    void push_back(const_reference value);
+    void push_front(const_reference value);
+    void pop_back();
+    void pop_front();
+    void clear();
+
+    const_reference front() const;
+    const_reference back()  const;
+    size_type size()      const;
+    bool      empty()     const;
+    size_type use_count() const;
+
+    const_iterator begin() const;
+    const_iterator end()   const;
+
+private:
+    void detach();
+    static void share(Block* block);
+    static void release(Block* block);
+
+private:
+    Block* block_;
+};
+
+#include "../templates/SharedList.cpp"
+
+#endif /// __SHARED_LIST_HPP__
@@ -0,0 +1,63 @@
+#ifndef __SORTED_LIST_HPP__
+#define __SORTED_LIST_HPP__
+
+#include "RankedList.hpp"
+#include <functional>
+
+/// Permanently sorted list over the RankedList skip index: lookups and
+/// sorted insertion descend the skip levels, iteration is plain level 0.
+/// Equal elements keep their insertion order.
+template <typename T, typename Compare = std::less<T> >
+class SortedList
+{
+public:
+    typedef typename RankedList<T>::size_type       size_type;
+    typedef typename RankedList<T>::value_type      value_type;
+    typedef typename RankedList<T>::const_reference reference;
+    typedef typename RankedList<T>::const_reference const_reference;
+    typedef typename RankedList<T>::difference_type difference_type;
+    typedef typename RankedList<T>::const_iterator  const_iterator;
+    typedef typename RankedList<T>::const_iterator  iterator;
+
+private:
+    typedef typename RankedList<T>::Node Node;
+
+public:
+    explicit SortedList(const Compare& comparison = Compare());
+    template <typename InputIterator>
+    SortedList(InputIterator first, InputIterator last, const Compare& comparison = Compare());
+
+    const_iterator insert_sorted(const_reference value);
+    const_iterator erase(const_iterator position);
+    size_type      erase(const_reference value);
+    void pop_front();
+    void pop_back();
+
+    const_iterator lower_bound(const_reference value) const;
+    const_iterator upper_bound(const_reference value) const;
+    const_iterator find(const_reference value)        const;
+    size_type      count(const_reference value)       const;
+
+    const_reference at(const size_type index)          const;
+    size_type       index_of(const_iterator position)  const;
+    const_reference front() const;
+    const_reference back()  const;
+
+    size_type size()  const;
+    bool      empty() const;
+    void      clear();
+
+    const_iterator begin() const;
+    const_iterator end()   const;
+
+private:
+    Node* bound(const_reference value, const bool upper) const;
+
+private:
+    RankedList<T> list_;
+    Compare comparison_;
+};
+
+#include "../templates/SortedList.cpp"
+
+#endif /// __SORTED_LIST_HPP__
@@ -0,0 +1,48 @@
+#ifndef __SPSC_QUEUE_HPP__
+#define __SPSC_QUEUE_HPP__
+
+#include "List.hpp"
+
+/// Unbounded single-producer single-consumer queue on List<T> nodes. Both
+/// push() and pop() are wait-free: one release store each, with no
+/// read-modify-write. The consumer never frees anything. Nodes it has
+/// passed stay on the chain behind head_, and the producer reuses them
+/// before allocating, so the queue stops allocating once it has grown to
+/// its working size.
+template <typename T>
+class SpscQueue
+{
+public:
+    typedef typename List<T>::size_type       size_type;
+    typedef typename List<T>::value_type      value_type;
+    typedef typename List<T>::reference       reference;
+    typedef typename List<T>::const_reference const_reference;
+
+private:
+    typedef typename List<T>::Node Node;
+
+public:
+    SpscQueue();
+    ~SpscQueue();
+
+    void push(const_reference value);
+    bool pop(reference value);
+    size_type drain_into(List<T>& list);
+    bool empty() const;
+
+private:
+    SpscQueue(const SpscQueue<T>& rhv);
+    SpscQueue<T>& operator=(const SpscQueue<T>& rhv);
+
+    Node* allocate();
+
+private:
+    Node* volatile head_;   ///< consumer: the last consumed node, data starts after it
+    Node* tail_;            ///< producer
+    Node* first_;           ///< producer: oldest node of the reuse cache
+    Node* headCopy_;        ///< producer: last head_ it has seen
+};
+
+#include "../templates/SpscQueue.cpp"
+
+#endif /// __SPSC_QUEUE_HPP__
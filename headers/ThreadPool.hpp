@@ -0,0 +1,95 @@
+#ifndef __THREAD_POOL_HPP__
+#define __THREAD_POOL_HPP__
+
+#include <cstdlib>
+#include <deque>
+#include <vector>
+#include <pthread.h>
+
+/// Fixed set of worker threads with one task deque each. A worker takes its
+/// own newest task first and, when it runs dry, steals the oldest task of
+/// another worker. Tasks are plain function/argument pairs, grouped by a
+/// TaskGroup whose wait() runs pending tasks itself instead of blocking,
+/// so waiting from inside a task cannot deadlock the pool.
+class ThreadPool
+{
+public:
+    typedef size_t size_type;
+    typedef void (*Function)(void*);
+
+    class TaskGroup {
+    friend class ThreadPool;
+    public:
+        explicit TaskGroup(ThreadPool& pool);
+        ~TaskGroup();
+
+        void run(Function function, void* argument);
+        void wait();
+
+    private:
+        TaskGroup(const TaskGroup& rhv);
+        TaskGroup& operator=(const TaskGroup& rhv);
+
+    private:
+        ThreadPool& pool_;
+        volatile size_type remaining_;
+    };
+
+private:
+    struct Task
+    {
+        Task(Function function = NULL, void* argument = NULL, TaskGroup* group = NULL)
+            : function_(function)
+            , argument_(argument)
+            , group_(group)
+        {}
+        Function function_;
+        void* argument_;
+        TaskGroup* group_;
+    };
+
+    struct Worker
+    {
+        Worker() { ::pthread_mutex_init(&mutex_, NULL); }
+        ~Worker() { ::pthread_mutex_destroy(&mutex_); }
+        pthread_mutex_t mutex_;
+        std::deque<Task> tasks_;
+        pthread_t thread_;
+    };
+
+    struct Start
+    {
+        ThreadPool* pool_;
+        size_type index_;
+    };
+
+public:
+    explicit ThreadPool(const size_type threads = 0);
+    ~ThreadPool();
+
+    static ThreadPool& instance();
+    size_type size() const;
+
+private:
+    ThreadPool(const ThreadPool& rhv);
+    ThreadPool& operator=(const ThreadPool& rhv);
+
+    void submit(const Task& task);
+    bool take(const size_type index, Task& task);
+    void execute(const Task& task);
+    void work(const size_type index);
+    static void* start(void* argument);
+
+private:
+    std::vector<Worker*> workers_;
+    std::vector<Start> starts_;
+    volatile size_type next_;
+    volatile size_type pending_;
+    bool stopping_;
+    pthread_mutex_t sleep_;
+    pthread_cond_t wake_;
+};
+
+#include "../templates/ThreadPool.cpp"
+
+#endif /// __THREAD_POOL_HPP__
@@ -1,6 +1,28 @@
 #include <gtest/gtest.h>
 #include "headers/List.hpp"
+#include "headers/RankedList.hpp"
+#include "headers/SortedList.hpp"
+#include "headers/IndexedList.hpp"
+#include "headers/OrientedList.hpp"
+#include "headers/LazyList.hpp"
+#include "headers/SharedList.hpp"
+#include "headers/ConcurrentList.hpp"
+#include "headers/LockFreeList.hpp"
+#include "headers/MpscQueue.hpp"
+#include "headers/SpscQueue.hpp"
+#include "headers/RcuList.hpp"
+#include "headers/ShardedList.hpp"
+#include "headers/ParallelList.hpp"
+#include "headers/NodeAllocator.hpp"
+#include "headers/Reclaimer.hpp"
+#include "headers/MutationBatch.hpp"
 #include <string>
+#include <functional>
+#include <cctype>
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+#include <pthread.h>
 
 // ======== Construction & Basic Operations ========
 TEST(ListTest, DefaultConstructorIsEmpty)
@@ -476,6 +498,63 @@ TEST(ListComparisonTest, LessEqualAndGreaterEqual)
     EXPECT_TRUE(a <= c);
     EXPECT_TRUE(c >= a);
 }
+
+TEST(ListComparisonTest, ThreeWayCompare)
+{
+    List<int> a;
+    a.push_back(1);
+    a.push_back(2);
+
+    List<int> b(a);
+    EXPECT_EQ(a.compare(b), 0);
+
+    b.push_back(0);
+    EXPECT_LT(a.compare(b), 0);
+    EXPECT_GT(b.compare(a), 0);
+    EXPECT_TRUE(a < b);
+    EXPECT_TRUE(b >= a);
+    EXPECT_FALSE(a > b);
+
+    List<std::string> s1;
+    s1.push_back("apple");
+    s1.push_back("pear");
+    List<std::string> s2;
+    s2.push_back("apple");
+    s2.push_back("peach");
+    EXPECT_GT(s1.compare(s2), 0);
+    EXPECT_TRUE(s2 <= s1);
+    EXPECT_TRUE(s1 != s2);
+}
+
+struct CountedEquality
+{
+    explicit CountedEquality(const int value = 0) : value_(value) {}
+    bool operator!=(const CountedEquality& rhv) const { ++calls; return value_ != rhv.value_; }
+    int value_;
+    static int calls;
+};
+int CountedEquality::calls = 0;
+
+TEST(ListComparisonTest, EqualityChecksSizeFirst)
+{
+    List<CountedEquality> a;
+    List<CountedEquality> b;
+    for (int i = 0; i < 10; ++i) {
+        a.push_back(CountedEquality(i));
+        b.push_back(CountedEquality(i));
+    }
+    b.push_back(CountedEquality(10));
+
+    CountedEquality::calls = 0;
+    EXPECT_FALSE(a == b);
+    EXPECT_TRUE(a != b);
+    EXPECT_EQ(CountedEquality::calls, 0);
+
+    b.pop_back();
+    EXPECT_TRUE(a == b);
+    EXPECT_EQ(CountedEquality::calls, 10);
+}
+
 // ======== Basic construction and push/pop tests ========
 TEST(ListTest, DefaultConstructorIsEmpty1)
 {
@@ -619,6 +698,1898 @@ TEST(ListTest, SortWorks)
     EXPECT_EQ(*it, 3);
 }
 
+// ======== Sorted set operations ========
+TEST(ListSetTest, UnionSpliceMovesNodesAndDropsDuplicates)
+{
+    int a[] = {1, 3, 5, 7};
+    int b[] = {2, 3, 6, 7, 9};
+    List<int> l1(a, a + 4);
+    List<int> l2(b, b + 5);
+
+    l1.set_union_splice(l2);
+
+    int expected[] = {1, 2, 3, 5, 6, 7, 9};
+    EXPECT_TRUE(l1 == List<int>(expected, expected + 7));
+    EXPECT_TRUE(l2.empty());
+}
+
+TEST(ListSetTest, UnionSpliceIntoEmpty)
+{
+    int b[] = {1, 2};
+    List<int> l1;
+    List<int> l2(b, b + 2);
+
+    l1.set_union_splice(l2);
+    EXPECT_EQ(l1.size(), 2u);
+    EXPECT_EQ(l1.back(), 2);
+    EXPECT_TRUE(l2.empty());
+}
+
+TEST(ListSetTest, IntersectionSplice)
+{
+    int a[] = {1, 2, 2, 3, 5, 8};
+    int b[] = {2, 2, 5, 7};
+    List<int> l1(a, a + 6);
+    const List<int> l2(b, b + 4);
+
+    l1.set_intersection_splice(l2);
+
+    int expected[] = {2, 2, 5};
+    EXPECT_TRUE(l1 == List<int>(expected, expected + 3));
+    EXPECT_EQ(l2.size(), 4u);
+}
+
+TEST(ListSetTest, DifferenceSpliceWithComparator)
+{
+    int a[] = {9, 7, 5, 3, 1};
+    int b[] = {8, 7, 3};
+    List<int> l1(a, a + 5);
+    List<int> l2(b, b + 3);
+
+    l1.set_difference_splice(l2, std::greater<int>());
+
+    int expected[] = {9, 5, 1};
+    EXPECT_TRUE(l1 == List<int>(expected, expected + 3));
+}
+
+// ======== Partial ordering ========
+TEST(ListOrderTest, PartialSortSelectsSmallestInOrder)
+{
+    int a[] = {9, 4, 7, 1, 8, 2, 6};
+    List<int> l(a, a + 7);
+
+    l.partial_sort(3);
+
+    EXPECT_EQ(l.size(), 7u);
+    List<int>::iterator it = l.begin();
+    EXPECT_EQ(*it, 1); ++it;
+    EXPECT_EQ(*it, 2); ++it;
+    EXPECT_EQ(*it, 4); ++it;
+    int rest[] = {9, 7, 8, 6};
+    for (int i = 0; i < 4; ++i, ++it) {
+        EXPECT_EQ(*it, rest[i]);
+    }
+}
+
+TEST(ListOrderTest, PartialSortTopKWithComparator)
+{
+    List<int> l;
+    for (int i = 0; i < 100; ++i) l.push_back((i * 37) % 100);
+
+    l.partial_sort(5, std::greater<int>());
+
+    int expected = 99;
+    List<int>::iterator it = l.begin();
+    for (int i = 0; i < 5; ++i, ++it) {
+        EXPECT_EQ(*it, expected--);
+    }
+}
+
+TEST(ListOrderTest, NthElementPartitionsAroundIndex)
+{
+    List<int> l;
+    for (int i = 0; i < 50; ++i) l.push_back((i * 17) % 50);
+
+    l.nth_element(20);
+
+    List<int>::iterator nth = l.begin();
+    for (int i = 0; i < 20; ++i) ++nth;
+    EXPECT_EQ(*nth, 20);
+    for (List<int>::iterator it = l.begin(); it != nth; ++it) {
+        EXPECT_LT(*it, 20);
+    }
+    for (List<int>::iterator it = nth; it != l.end(); ++it) {
+        EXPECT_GE(*it, 20);
+    }
+    EXPECT_EQ(l.size(), 50u);
+}
+
+struct IsEven
+{
+    bool operator()(int value) const { return 0 == value % 2; }
+};
+
+TEST(ListOrderTest, StablePartition)
+{
+    int a[] = {1, 2, 3, 4, 5, 6};
+    List<int> l(a, a + 6);
+
+    List<int>::iterator boundary = l.stable_partition(IsEven());
+
+    int expected[] = {2, 4, 6, 1, 3, 5};
+    EXPECT_TRUE(l == List<int>(expected, expected + 6));
+    EXPECT_EQ(*boundary, 1);
+    EXPECT_EQ(l.back(), 5);
+}
+
+// ======== Dedupe ========
+TEST(ListTest, DedupeKeepsFirstOccurrence)
+{
+    int a[] = {3, 1, 3, 2, 1, 4, 2, 3};
+    List<int> l(a, a + 8);
+
+    EXPECT_EQ(l.dedupe(), 4u);
+
+    int expected[] = {3, 1, 2, 4};
+    EXPECT_TRUE(l == List<int>(expected, expected + 4));
+}
+
+struct CaseInsensitiveHash
+{
+    size_t operator()(const std::string& value) const
+    {
+        size_t hash = 0;
+        for (size_t i = 0; i < value.size(); ++i) {
+            hash = hash * 31 + static_cast<size_t>(std::tolower(value[i]));
+        }
+        return hash;
+    }
+};
+
+struct CaseInsensitiveEqual
+{
+    bool operator()(const std::string& lhv, const std::string& rhv) const
+    {
+        if (lhv.size() != rhv.size()) return false;
+        for (size_t i = 0; i < lhv.size(); ++i) {
+            if (std::tolower(lhv[i]) != std::tolower(rhv[i])) return false;
+        }
+        return true;
+    }
+};
+
+TEST(ListTest, DedupeWithCustomHashAndEquality)
+{
+    List<std::string> l;
+    l.push_back("Alpha");
+    l.push_back("beta");
+    l.push_back("ALPHA");
+    l.push_back("Beta");
+    l.push_back("gamma");
+
+    EXPECT_EQ(l.dedupe(CaseInsensitiveHash(), CaseInsensitiveEqual()), 2u);
+    EXPECT_EQ(l.size(), 3u);
+    EXPECT_EQ(l.front(), "Alpha");
+    EXPECT_EQ(l.back(), "gamma");
+
+    List<std::string> plain;
+    plain.push_back("x");
+    plain.push_back("y");
+    plain.push_back("x");
+    EXPECT_EQ(plain.dedupe(), 1u);
+    EXPECT_EQ(plain.back(), "y");
+}
+
+TEST(ListTest, DedupeWideIntegersAndFloatingPoint)
+{
+    List<long long> wide;
+    wide.push_back(1LL << 40);
+    wide.push_back(1);
+    wide.push_back((1LL << 40) + 1);
+    wide.push_back(1LL << 40);
+    EXPECT_EQ(wide.dedupe(), 1u);
+    EXPECT_EQ(wide.size(), 3u);
+
+    List<double> real;
+    real.push_back(0.0);
+    real.push_back(1.5);
+    real.push_back(-0.0);
+    real.push_back(1.5);
+    real.push_back(2.25);
+    EXPECT_EQ(real.dedupe(), 2u);
+    EXPECT_EQ(real.back(), 2.25);
+
+    if (8 == sizeof(size_t)) {
+        /// 64-bit FNV-1a of "a"
+        EXPECT_EQ(ListHash<std::string>()("a"), static_cast<size_t>(0xaf63dc4c8601ec8cULL));
+        EXPECT_NE(ListHashing::scatter(1) >> 40, ListHashing::scatter(2) >> 40);
+    }
+}
+
+// ======== Run removal ========
+struct IsMultipleOf
+{
+    explicit IsMultipleOf(int divisor) : divisor_(divisor) {}
+    bool operator()(int value) const { return 0 == value % divisor_; }
+    int divisor_;
+};
+
+TEST(ListTest, RemoveIfReturnsRemovedCount)
+{
+    List<int> l;
+    for (int i = 0; i < 20; ++i) l.push_back(i);
+
+    EXPECT_EQ(l.remove_if(IsMultipleOf(3)), 7u);
+    EXPECT_EQ(l.size(), 13u);
+    EXPECT_EQ(l.front(), 1);
+    EXPECT_EQ(l.back(), 19);
+    EXPECT_EQ(l.remove_if(IsMultipleOf(1)), 13u);
+    EXPECT_TRUE(l.empty());
+}
+
+TEST(ListTest, RemoveValueAliasingAnElement)
+{
+    int a[] = {5, 5, 1, 5, 2, 5, 5};
+    List<int> l(a, a + 7);
+
+    EXPECT_EQ(l.remove(l.front()), 5u);
+
+    int expected[] = {1, 2};
+    EXPECT_TRUE(l == List<int>(expected, expected + 2));
+}
+
+TEST(ListTest, UniqueReturnsRemovedCount)
+{
+    int a[] = {1, 1, 1, 2, 3, 3, 1, 1};
+    List<int> l(a, a + 8);
+
+    EXPECT_EQ(l.unique(), 4u);
+
+    int expected[] = {1, 2, 3, 1};
+    EXPECT_TRUE(l == List<int>(expected, expected + 4));
+    EXPECT_EQ(l.back(), 1);
+}
+
+TEST(ListTest, EraseWholeRange)
+{
+    List<int> l(5, 1);
+    List<int>::iterator it = l.erase(l.begin(), l.end());
+    EXPECT_TRUE(it == l.end());
+    EXPECT_TRUE(l.empty());
+    l.push_back(2);
+    EXPECT_EQ(l.front(), 2);
+}
+
+// ======== RankedList ========
+TEST(RankedListTest, PositionalAccess)
+{
+    RankedList<int> l;
+    for (int i = 0; i < 1000; ++i) l.push_back(i);
+
+    EXPECT_EQ(l.size(), 1000u);
+    EXPECT_EQ(l.at(0), 0);
+    EXPECT_EQ(l.at(537), 537);
+    EXPECT_EQ(l.at(999), 999);
+    EXPECT_TRUE(l.iterator_at(1000) == l.end());
+
+    RankedList<int>::iterator it = l.iterator_at(250);
+    EXPECT_EQ(*it, 250);
+    EXPECT_EQ(l.index_of(it), 250u);
+    EXPECT_EQ(l.index_of(l.end()), 1000u);
+    EXPECT_EQ(l.distance(it, l.iterator_at(900)), 650);
+    EXPECT_EQ(l.distance(l.iterator_at(900), it), -650);
+}
+
+TEST(RankedListTest, MatchesVectorUnderRandomMutation)
+{
+    RankedList<int> l;
+    std::vector<int> model;
+    unsigned int seed = 12345;
+
+    for (int step = 0; step < 3000; ++step) {
+        seed = seed * 1103515245u + 12345u;
+        const size_t position = model.empty() ? 0 : (seed >> 8) % (model.size() + 1);
+        if (model.empty() || (seed & 0x300) != 0) {
+            l.insert(l.iterator_at(position), step);
+            model.insert(model.begin() + position, step);
+        } else {
+            const size_t index = position % model.size();
+            l.erase(l.iterator_at(index));
+            model.erase(model.begin() + index);
+        }
+    }
+
+    ASSERT_EQ(l.size(), model.size());
+    size_t index = 0;
+    for (RankedList<int>::iterator it = l.begin(); it != l.end(); ++it, ++index) {
+        EXPECT_EQ(*it, model[index]);
+        EXPECT_EQ(l.at(index), model[index]);
+        EXPECT_EQ(l.index_of(it), index);
+    }
+}
+
+TEST(RankedListTest, SpliceKeepsBothIndexes)
+{
+    int a[] = {0, 1, 2, 3, 4};
+    int b[] = {10, 11, 12};
+    RankedList<int> l1(a, a + 5);
+    RankedList<int> l2(b, b + 3);
+
+    l1.splice(l1.iterator_at(2), l2, l2.iterator_at(1));
+    EXPECT_EQ(l1.size(), 6u);
+    EXPECT_EQ(l2.size(), 2u);
+    EXPECT_EQ(l1.at(2), 11);
+    EXPECT_EQ(l1.at(3), 2);
+    EXPECT_EQ(l2.at(1), 12);
+
+    l1.splice(l1.end(), l2, l2.begin(), l2.end());
+    EXPECT_TRUE(l2.empty());
+    EXPECT_EQ(l1.size(), 8u);
+    EXPECT_EQ(l1.at(6), 10);
+    EXPECT_EQ(l1.at(7), 12);
+    EXPECT_EQ(l1.index_of(l1.iterator_at(7)), 7u);
+
+    l1.pop_front();
+    l1.pop_back();
+    EXPECT_EQ(l1.front(), 1);
+    EXPECT_EQ(l1.back(), 10);
+    EXPECT_EQ(l1.at(5), 10);
+}
+
+static void expectRanked(const RankedList<int>& l, const std::vector<int>& model)
+{
+    ASSERT_EQ(l.size(), model.size());
+    size_t index = 0;
+    for (RankedList<int>::const_iterator it = l.begin(); it != l.end(); ++it, ++index) {
+        ASSERT_EQ(*it, model[index]);
+        ASSERT_EQ(l.at(index), model[index]);
+        ASSERT_EQ(l.index_of(it), index);
+    }
+    ASSERT_EQ(l.index_of(l.end()), model.size());
+}
+
+TEST(RankedListTest, RangeSpliceMatchesVector)
+{
+    RankedList<int> l1;
+    RankedList<int> l2;
+    std::vector<int> m1;
+    std::vector<int> m2;
+    for (int i = 0; i < 400; ++i) {
+        l1.push_back(i);
+        m1.push_back(i);
+    }
+    unsigned int seed = 99;
+    for (int step = 0; step < 300; ++step) {
+        seed = seed * 1103515245u + 12345u;
+        const bool forward = 0 != (seed & 0x100);
+        RankedList<int>& from = forward ? l1 : l2;
+        RankedList<int>& to = forward ? l2 : l1;
+        std::vector<int>& source = forward ? m1 : m2;
+        std::vector<int>& target = forward ? m2 : m1;
+
+        const size_t a = (seed >> 4) % (source.size() + 1);
+        const size_t b = (seed >> 14) % (source.size() + 1);
+        const size_t first = std::min(a, b);
+        const size_t last = std::max(a, b);
+        const size_t position = (seed >> 22) % (target.size() + 1);
+
+        to.splice(to.iterator_at(position), from, from.iterator_at(first), from.iterator_at(last));
+        std::vector<int> piece(source.begin() + first, source.begin() + last);
+        source.erase(source.begin() + first, source.begin() + last);
+        target.insert(target.begin() + position, piece.begin(), piece.end());
+
+        /// within one list: move a range in front of a position outside it
+        if (m1.size() > 2) {
+            const size_t cut = (seed >> 9) % (m1.size() - 1) + 1;
+            const size_t end = cut + (seed >> 19) % (m1.size() - cut) + 1;
+            const size_t where = (seed >> 3) % cut;
+            l1.splice(l1.iterator_at(where), l1, l1.iterator_at(cut), l1.iterator_at(end));
+            std::rotate(m1.begin() + where, m1.begin() + cut, m1.begin() + end);
+        }
+    }
+    expectRanked(l1, m1);
+    expectRanked(l2, m2);
+}
+
+// ======== Positional access ========
+TEST(ListTest, AtAndSeekWalkFromNearestAnchor)
+{
+    List<int> l;
+    for (int i = 0; i < 100; ++i) l.push_back(i);
+
+    EXPECT_EQ(l.at(0), 0);
+    EXPECT_EQ(l.at(99), 99);
+    EXPECT_EQ(l.at(50), 50);
+    EXPECT_EQ(l.at(51), 51);
+    EXPECT_EQ(l.at(10), 10);
+    EXPECT_EQ(*l.seek(75), 75);
+    EXPECT_TRUE(l.seek(100) == l.end());
+
+    const List<int>& cl = l;
+    EXPECT_EQ(cl.at(3), 3);
+}
+
+TEST(ListTest, FingerFollowsMutations)
+{
+    List<int> l;
+    for (int i = 0; i < 10; ++i) l.push_back(i);
+
+    EXPECT_EQ(l.at(5), 5);
+    l.push_front(-1);
+    EXPECT_EQ(l.at(5), 4);
+    EXPECT_EQ(l.size(), 11u);
+
+    l.erase(l.seek(4));
+    EXPECT_EQ(l.at(4), 4);
+    EXPECT_EQ(l.size(), 10u);
+
+    l.remove_if(IsMultipleOf(2));
+    EXPECT_EQ(l.at(0), -1);
+    EXPECT_EQ(l.at(3), 7);
+    EXPECT_EQ(l.size(), 5u);
+
+    l.reverse();
+    EXPECT_EQ(l.at(0), 9);
+    EXPECT_EQ(l.at(4), -1);
+
+    List<int> other(3, 42);
+    l.splice(l.seek(1), other);
+    EXPECT_EQ(l.at(1), 42);
+    EXPECT_EQ(l.at(4), 7);
+    EXPECT_EQ(l.size(), 8u);
+    EXPECT_EQ(other.size(), 0u);
+}
+
+TEST(ListTest, FingerAndSizeMatchVectorUnderRandomEdits)
+{
+    List<int> l;
+    std::vector<int> oracle;
+    std::srand(7);
+    for (int step = 0; step < 3000; ++step) {
+        const int value = step;
+        const size_t index = oracle.empty() ? 0 : static_cast<size_t>(std::rand()) % oracle.size();
+        switch (std::rand() % 9) {
+        case 0: l.push_back(value); oracle.push_back(value); break;
+        case 1: l.push_front(value); oracle.insert(oracle.begin(), value); break;
+        case 2: if (!oracle.empty()) { l.pop_back(); oracle.pop_back(); } break;
+        case 3: if (!oracle.empty()) { l.pop_front(); oracle.erase(oracle.begin()); } break;
+        case 4: l.insert(l.seek(index), value); oracle.insert(oracle.begin() + index, value); break;
+        case 5: if (!oracle.empty()) { l.erase(l.seek(index)); oracle.erase(oracle.begin() + index); } break;
+        case 6: l.reverse(); std::reverse(oracle.begin(), oracle.end()); break;
+        case 7: l.resize(oracle.size() / 2 + 1, value); oracle.resize(oracle.size() / 2 + 1, value); break;
+        default: {
+            List<int> other(2, value);
+            l.splice(l.end(), other);
+            oracle.insert(oracle.end(), 2, value);
+        }
+        }
+        ASSERT_EQ(l.size(), oracle.size());
+        if (!oracle.empty()) {
+            ASSERT_EQ(l.at(index % oracle.size()), oracle[index % oracle.size()]);
+            ASSERT_EQ(l.at(oracle.size() - 1), oracle.back());
+        }
+        ASSERT_TRUE(l.seek(oracle.size()) == l.end());
+    }
+}
+
+struct PositionalReader
+{
+    const List<int>* list_;
+    long sum_;
+};
+
+static void*
+readPositions(void* argument)
+{
+    PositionalReader& reader = *static_cast<PositionalReader*>(argument);
+    for (size_t i = 0; i < reader.list_->size(); i += 7) {
+        reader.sum_ += reader.list_->at(i) + *reader.list_->seek(reader.list_->size() - 1 - i);
+    }
+    return NULL;
+}
+
+TEST(ListTest, ConstPositionalReadsShareAList)
+{
+    List<int> l;
+    for (int i = 0; i < 2000; ++i) l.push_back(1);
+    l.at(1000);
+
+    PositionalReader readers[3];
+    pthread_t threads[3];
+    for (int i = 0; i < 3; ++i) {
+        readers[i].list_ = &l;
+        readers[i].sum_ = 0;
+        pthread_create(&threads[i], NULL, readPositions, &readers[i]);
+    }
+    for (int i = 0; i < 3; ++i) {
+        pthread_join(threads[i], NULL);
+        EXPECT_EQ(readers[i].sum_, 2 * 286);
+    }
+}
+
+// ======== SortedList ========
+TEST(SortedListTest, InsertSortedKeepsOrder)
+{
+    int a[] = {5, 3, 9, 1, 7, 3};
+    SortedList<int> l(a, a + 6);
+
+    int expected[] = {1, 3, 3, 5, 7, 9};
+    int i = 0;
+    for (SortedList<int>::const_iterator it = l.begin(); it != l.end(); ++it, ++i) {
+        EXPECT_EQ(*it, expected[i]);
+    }
+    EXPECT_EQ(l.size(), 6u);
+    EXPECT_EQ(l.front(), 1);
+    EXPECT_EQ(l.back(), 9);
+}
+
+TEST(SortedListTest, BoundsFindAndErase)
+{
+    SortedList<int> l;
+    for (int i = 0; i < 500; ++i) l.insert_sorted((i * 7) % 250);
+
+    EXPECT_EQ(*l.lower_bound(100), 100);
+    EXPECT_EQ(l.index_of(l.lower_bound(100)), 200u);
+    EXPECT_EQ(l.index_of(l.upper_bound(100)), 202u);
+    EXPECT_EQ(l.count(100), 2u);
+    EXPECT_TRUE(l.find(250) == l.end());
+    EXPECT_TRUE(l.lower_bound(1000) == l.end());
+
+    EXPECT_EQ(l.erase(100), 2u);
+    EXPECT_TRUE(l.find(100) == l.end());
+    EXPECT_EQ(*l.lower_bound(100), 101);
+    EXPECT_EQ(l.size(), 498u);
+    EXPECT_EQ(l.at(0), 0);
+    EXPECT_EQ(l.at(497), 249);
+
+    int previous = -1;
+    for (SortedList<int>::const_iterator it = l.begin(); it != l.end(); ++it) {
+        EXPECT_LE(previous, *it);
+        previous = *it;
+    }
+}
+
+TEST(SortedListTest, InsertSortedKeepsRanksExact)
+{
+    SortedList<int> l;
+    std::vector<int> v;
+    unsigned int seed = 7;
+    for (int i = 0; i < 2000; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        const int value = static_cast<int>((seed >> 16) % 300);
+        SortedList<int>::const_iterator it = l.insert_sorted(value);
+        std::vector<int>::iterator bound = std::upper_bound(v.begin(), v.end(), value);
+        EXPECT_EQ(l.index_of(it), static_cast<size_t>(bound - v.begin()));
+        v.insert(bound, value);
+    }
+    for (size_t i = 0; i < v.size(); ++i) {
+        ASSERT_EQ(l.at(i), v[i]);
+    }
+}
+
+TEST(SortedListTest, CustomComparator)
+{
+    SortedList<std::string, std::greater<std::string> > l;
+    l.insert_sorted("b");
+    l.insert_sorted("d");
+    l.insert_sorted("a");
+    l.insert_sorted("c");
+
+    EXPECT_EQ(l.front(), "d");
+    EXPECT_EQ(l.back(), "a");
+    EXPECT_EQ(*l.find("c"), "c");
+    l.erase(l.find("c"));
+    EXPECT_EQ(l.at(1), "b");
+}
+
+// ======== IndexedList ========
+TEST(IndexedListTest, FindCountRemove)
+{
+    IndexedList<int> l;
+    for (int i = 0; i < 1000; ++i) l.push_back(i % 100);
+
+    EXPECT_EQ(l.size(), 1000u);
+    EXPECT_TRUE(l.contains(42));
+    EXPECT_FALSE(l.contains(100));
+    EXPECT_EQ(*l.find(42), 42);
+    EXPECT_TRUE(l.find(-1) == l.end());
+    EXPECT_EQ(l.count(7), 10u);
+
+    EXPECT_EQ(l.remove(7), 10u);
+    EXPECT_FALSE(l.contains(7));
+    EXPECT_EQ(l.size(), 990u);
+    EXPECT_EQ(l.remove(l.front()), 10u);
+    EXPECT_FALSE(l.contains(0));
+    EXPECT_EQ(l.front(), 1);
+}
+
+TEST(IndexedListTest, IndexSurvivesSpliceSortMergeUnique)
+{
+    int a[] = {5, 3, 5, 1};
+    int b[] = {4, 2, 2};
+    IndexedList<int> l1(a, a + 4);
+    IndexedList<int> l2(b, b + 3);
+
+    l1.splice(l1.begin(), l2, l2.begin());
+    EXPECT_TRUE(l1.contains(4));
+    EXPECT_FALSE(l2.contains(4));
+
+    l1.sort();
+    l2.sort();
+    l1.merge(l2);
+    EXPECT_TRUE(l2.empty());
+    EXPECT_EQ(l1.count(2), 2u);
+    EXPECT_EQ(l1.size(), 7u);
+
+    EXPECT_EQ(l1.unique(), 2u);
+    EXPECT_EQ(l1.count(2), 1u);
+    EXPECT_EQ(l1.count(5), 1u);
+
+    int expected[] = {1, 2, 3, 4, 5};
+    int i = 0;
+    for (IndexedList<int>::const_iterator it = l1.begin(); it != l1.end(); ++it, ++i) {
+        EXPECT_EQ(*it, expected[i]);
+        EXPECT_TRUE(l1.find(*it) == it);
+    }
+
+    IndexedList<int> l3;
+    l3.push_back(9);
+    l3.splice(l3.end(), l1);
+    EXPECT_TRUE(l1.empty());
+    EXPECT_FALSE(l1.contains(3));
+    EXPECT_TRUE(l3.contains(3));
+    l3.erase(l3.find(3));
+    EXPECT_FALSE(l3.contains(3));
+    EXPECT_EQ(l3.size(), 5u);
+}
+
+struct CountingHash
+{
+    size_t operator()(const int value) const { ++calls; return ListHash<int>()(value); }
+    static int calls;
+};
+int CountingHash::calls = 0;
+
+TEST(IndexedListTest, MovedEntriesKeepTheirHashes)
+{
+    IndexedList<int, CountingHash> l1;
+    IndexedList<int, CountingHash> l2;
+    for (int i = 0; i < 100; ++i) l1.push_back(i);
+    for (int i = 100; i < 300; ++i) l2.push_back(i);
+
+    CountingHash::calls = 0;
+    l1.splice(l1.end(), l2);
+    EXPECT_EQ(CountingHash::calls, 0);
+    EXPECT_EQ(l1.size(), 300u);
+    EXPECT_TRUE(l2.empty());
+
+    IndexedList<int, CountingHash>::const_iterator first = l1.find(10);
+    IndexedList<int, CountingHash>::const_iterator last = l1.find(20);
+    CountingHash::calls = 0;
+    l2.splice(l2.end(), l1, first, last);
+    EXPECT_EQ(CountingHash::calls, 10);
+
+    for (int i = 0; i < 300; ++i) {
+        const bool moved = i >= 10 && i < 20;
+        EXPECT_EQ(l1.contains(i), !moved);
+        EXPECT_EQ(l2.contains(i), moved);
+    }
+    EXPECT_EQ(l1.size(), 290u);
+    EXPECT_EQ(l2.size(), 10u);
+}
+
+struct ShorterThan
+{
+    bool operator()(const std::string& lhv, const std::string& rhv) const { return lhv.size() < rhv.size(); }
+};
+
+TEST(ListTest, SortIsStableAndRelinksNodes)
+{
+    List<std::string> l;
+    const char* words[] = {"pear", "fig", "apple", "kiwi", "plum", "date", "lime"};
+    for (int i = 0; i < 7; ++i) l.push_back(words[i]);
+
+    List<std::string>::iterator fig = l.begin();
+    ++fig;
+    l.sort(ShorterThan());
+
+    const char* expected[] = {"fig", "pear", "kiwi", "plum", "date", "lime", "apple"};
+    int i = 0;
+    for (List<std::string>::iterator it = l.begin(); it != l.end(); ++it, ++i) {
+        EXPECT_EQ(*it, expected[i]);
+    }
+    EXPECT_TRUE(fig == l.begin());
+
+    List<int> big;
+    for (int k = 0; k < 5000; ++k) big.push_back((k * 7919) % 5000);
+    big.sort();
+    int previous = -1;
+    for (List<int>::iterator it = big.begin(); it != big.end(); ++it) {
+        EXPECT_EQ(*it, previous + 1);
+        previous = *it;
+    }
+    int expectedBack = 4999;
+    for (List<int>::reverse_iterator it = big.rbegin(); it != big.rend(); ++it) {
+        EXPECT_EQ(*it, expectedBack--);
+    }
+    EXPECT_EQ(expectedBack, -1);
+    EXPECT_EQ(big.size(), 5000u);
+}
+
+struct CountedInt
+{
+    static int made;
+    int value_;
+    CountedInt(int value = 0) : value_(value) { ++made; }
+    CountedInt(const CountedInt& rhv) : value_(rhv.value_) { ++made; }
+    bool operator<(const CountedInt& rhv) const { return value_ < rhv.value_; }
+};
+int CountedInt::made = 0;
+
+TEST(ListTest, SortConstructsNoValues)
+{
+    List<CountedInt> l;
+    for (int i = 0; i < 100; ++i) l.push_back(CountedInt(99 - i));
+    CountedInt::made = 0;
+    l.sort();
+    EXPECT_EQ(CountedInt::made, 0);
+    EXPECT_EQ(l.front().value_, 0);
+    EXPECT_EQ(l.back().value_, 99);
+}
+
+struct IsOddCounted
+{
+    bool operator()(const CountedInt& value) const { return 1 == value.value_ % 2; }
+};
+
+TEST(ListOrderTest, SelectionRelinksEveryIndexWithoutConstructingValues)
+{
+    for (size_t index = 0; index < 40; ++index) {
+        List<CountedInt> l;
+        for (int i = 0; i < 40; ++i) l.push_back(CountedInt((i * 13) % 20));
+        CountedInt::made = 0;
+        l.nth_element(index);
+        EXPECT_EQ(CountedInt::made, 0);
+
+        const int expected = static_cast<int>(index / 2);
+        EXPECT_EQ(l.at(index).value_, expected);
+        size_t position = 0;
+        for (List<CountedInt>::iterator it = l.begin(); it != l.end(); ++it, ++position) {
+            EXPECT_TRUE(position < index ? (*it).value_ <= expected : (*it).value_ >= expected);
+        }
+        size_t backwards = 0;
+        for (List<CountedInt>::reverse_iterator it = l.rbegin(); it != l.rend(); ++it) ++backwards;
+        EXPECT_EQ(backwards, 40u);
+    }
+
+    List<CountedInt> l;
+    for (int i = 0; i < 10; ++i) l.push_back(CountedInt(i));
+    CountedInt::made = 0;
+    List<CountedInt>::iterator boundary = l.stable_partition(IsOddCounted());
+    EXPECT_EQ(CountedInt::made, 0);
+    EXPECT_EQ((*boundary).value_, 0);
+    EXPECT_EQ(l.front().value_, 1);
+    EXPECT_EQ(l.back().value_, 8);
+    EXPECT_EQ(l.size(), 10u);
+}
+
+// ======== OrientedList ========
+TEST(OrientedListTest, ReverseFlipsViewInConstantTime)
+{
+    OrientedList<int> l;
+    for (int i = 1; i <= 4; ++i) l.push_back(i);
+
+    l.reverse();
+    EXPECT_TRUE(l.reversed());
+    EXPECT_EQ(l.front(), 4);
+    EXPECT_EQ(l.back(), 1);
+
+    int expected = 4;
+    for (OrientedList<int>::iterator it = l.begin(); it != l.end(); ++it) {
+        EXPECT_EQ(*it, expected--);
+    }
+    EXPECT_EQ(expected, 0);
+
+    OrientedList<int>::iterator last = l.end();
+    --last;
+    EXPECT_EQ(*last, 1);
+
+    l.push_back(0);
+    l.push_front(5);
+    l.pop_front();
+    EXPECT_EQ(l.front(), 4);
+    EXPECT_EQ(l.back(), 0);
+
+    OrientedList<int>::iterator it = l.begin();
+    ++it;
+    it = l.insert(it, 10);
+    EXPECT_EQ(*it, 10);
+    it = l.erase(it);
+    EXPECT_EQ(*it, 3);
+
+    l.normalize();
+    EXPECT_FALSE(l.reversed());
+    int normalized[] = {4, 3, 2, 1, 0};
+    int i = 0;
+    for (OrientedList<int>::const_iterator cit = l.begin(); cit != l.end(); ++cit, ++i) {
+        EXPECT_EQ(*cit, normalized[i]);
+    }
+}
+
+TEST(OrientedListTest, SpliceKeepsLogicalOrder)
+{
+    OrientedList<int> l1;
+    OrientedList<int> l2;
+    for (int i = 1; i <= 3; ++i) {
+        l1.push_back(i);
+        l2.push_back(i * 10);
+    }
+    l1.reverse();
+
+    l1.splice(l1.end(), l2);
+    EXPECT_TRUE(l2.empty());
+
+    int expected[] = {3, 2, 1, 10, 20, 30};
+    int i = 0;
+    for (OrientedList<int>::iterator it = l1.begin(); it != l1.end(); ++it, ++i) {
+        EXPECT_EQ(*it, expected[i]);
+    }
+    EXPECT_EQ(l1.size(), 6u);
+}
+
+// ======== LazyList ========
+TEST(LazyListTest, EraseLeavesTombstonesUntilThreshold)
+{
+    LazyList<int> l(0.4);
+    for (int i = 0; i < 10; ++i) l.push_back(i);
+
+    LazyList<int>::iterator it = l.begin();
+    ++it;
+    it = l.erase(it);
+    EXPECT_EQ(*it, 2);
+    it = l.erase(it);
+    EXPECT_EQ(*it, 3);
+    EXPECT_EQ(l.size(), 8u);
+    EXPECT_EQ(l.tombstones(), 2u);
+
+    int expected[] = {0, 3, 4, 5, 6, 7, 8, 9};
+    int i = 0;
+    for (LazyList<int>::const_iterator cit = l.begin(); cit != l.end(); ++cit, ++i) {
+        EXPECT_EQ(*cit, expected[i]);
+    }
+    EXPECT_EQ(i, 8);
+
+    l.pop_front();
+    l.pop_back();
+    EXPECT_EQ(l.front(), 3);
+    EXPECT_EQ(l.back(), 8);
+    EXPECT_EQ(l.tombstones(), 4u);
+
+    it = l.begin();
+    it = l.erase(it);
+    EXPECT_EQ(l.tombstones(), 0u);
+    EXPECT_EQ(*it, 4);
+    EXPECT_EQ(l.size(), 5u);
+    EXPECT_EQ(l.front(), 4);
+
+    LazyList<int>::iterator last = l.end();
+    --last;
+    EXPECT_EQ(*last, 8);
+}
+
+TEST(LazyListTest, ManualCompaction)
+{
+    LazyList<int> l(1.0);
+    for (int i = 0; i < 6; ++i) l.push_back(i);
+
+    LazyList<int>::iterator it = l.begin();
+    while (it != l.end()) {
+        if (*it % 2 == 0) {
+            it = l.erase(it);
+            continue;
+        }
+        ++it;
+    }
+    EXPECT_EQ(l.tombstones(), 3u);
+    EXPECT_EQ(l.size(), 3u);
+
+    l.compact_tombstones();
+    EXPECT_EQ(l.tombstones(), 0u);
+    EXPECT_EQ(l.front(), 1);
+    EXPECT_EQ(l.back(), 5);
+
+    l.insert(l.begin(), -1);
+    EXPECT_EQ(l.front(), -1);
+    EXPECT_EQ(l.size(), 4u);
+
+    while (!l.empty()) l.pop_back();
+    EXPECT_TRUE(l.begin() == l.end());
+}
+
+// ======== SharedList ========
+TEST(SharedListTest, CopiesShareUntilFirstWrite)
+{
+    SharedList<int> a;
+    for (int i = 0; i < 5; ++i) a.push_back(i);
+
+    SharedList<int> b(a);
+    SharedList<int> c;
+    c = b;
+    EXPECT_EQ(a.use_count(), 3u);
+    EXPECT_TRUE(&a.list() == &c.list());
+
+    b.push_back(5);
+    EXPECT_EQ(a.use_count(), 2u);
+    EXPECT_EQ(b.use_count(), 1u);
+    EXPECT_EQ(a.size(), 5u);
+    EXPECT_EQ(b.size(), 6u);
+    EXPECT_EQ(b.back(), 5);
+    EXPECT_EQ(c.back(), 4);
+
+    c.mutate().reverse();
+    EXPECT_EQ(c.front(), 4);
+    EXPECT_EQ(a.front(), 0);
+    EXPECT_EQ(a.use_count(), 1u);
+
+    a.clear();
+    EXPECT_TRUE(a.empty());
+    EXPECT_EQ(b.size(), 6u);
+}
+
+struct SnapshotReader
+{
+    SharedList<int> snapshot_;
+    long sum_;
+};
+
+static void*
+readSnapshot(void* argument)
+{
+    SnapshotReader* reader = static_cast<SnapshotReader*>(argument);
+    for (int round = 0; round < 50; ++round) {
+        SharedList<int> local(reader->snapshot_);
+        for (SharedList<int>::const_iterator it = local.begin(); it != local.end(); ++it) {
+            reader->sum_ += *it;
+        }
+    }
+    return NULL;
+}
+
+TEST(SharedListTest, SnapshotsCrossThreads)
+{
+    SharedList<int> source;
+    for (int i = 1; i <= 100; ++i) source.push_back(i);
+
+    SnapshotReader readers[4];
+    pthread_t threads[4];
+    for (int i = 0; i < 4; ++i) {
+        readers[i].snapshot_ = source;
+        readers[i].sum_ = 0;
+        pthread_create(&threads[i], NULL, readSnapshot, &readers[i]);
+    }
+    source.push_back(101);
+    for (int i = 0; i < 4; ++i) {
+        pthread_join(threads[i], NULL);
+        EXPECT_EQ(readers[i].sum_, 50L * 5050L);
+    }
+    EXPECT_EQ(source.use_count(), 1u);
+    EXPECT_EQ(source.size(), 101u);
+}
+
+// ======== Node handles ========
+TEST(ListTest, ExtractAndReinsertMovesTheSameNode)
+{
+    int a[] = {1, 2, 3};
+    List<int> source(a, a + 3);
+    List<int> target;
+    target.push_back(10);
+
+    List<int>::iterator second = source.begin();
+    ++second;
+    const int* address = &*second;
+
+    List<int>::node_handle handle = source.extract(second);
+    EXPECT_FALSE(handle.empty());
+    EXPECT_EQ(handle.value(), 2);
+    EXPECT_EQ(source.size(), 2u);
+    EXPECT_EQ(source.back(), 3);
+
+    handle.value() = 20;
+    List<int>::iterator inserted = target.insert(target.begin(), handle);
+    EXPECT_TRUE(handle.empty());
+    EXPECT_EQ(&*inserted, address);
+    EXPECT_EQ(target.front(), 20);
+    EXPECT_EQ(target.size(), 2u);
+
+    target.insert(target.end(), source.extract(source.begin()));
+    EXPECT_EQ(target.back(), 1);
+    EXPECT_EQ(source.front(), 3);
+
+    List<int>::node_handle dropped = source.extract(source.begin());
+    EXPECT_TRUE(source.empty());
+    List<int>::iterator unchanged = target.insert(target.begin(), List<int>::node_handle());
+    EXPECT_TRUE(unchanged == target.begin());
+}
+
+TEST(ListTest, AssignReusesNodesAndResizeTrimsInBulk)
+{
+    int a[] = {1, 2, 3, 4, 5};
+    List<int> source(a, a + 5);
+    List<int> target(a, a + 2);
+    const int* first = &target.front();
+
+    target = source;
+    EXPECT_EQ(&target.front(), first);
+    EXPECT_TRUE(target == source);
+    EXPECT_EQ(target.back(), 5);
+
+    List<int> shorter(a + 3, a + 5);
+    target = shorter;
+    EXPECT_EQ(&target.front(), first);
+    EXPECT_EQ(target.size(), 2u);
+    EXPECT_EQ(target.back(), 5);
+
+    target.resize(4, 9);
+    EXPECT_EQ(target.size(), 4u);
+    EXPECT_EQ(target.back(), 9);
+    target.resize(1);
+    EXPECT_EQ(target.size(), 1u);
+    EXPECT_EQ(target.back(), 4);
+    target.push_back(7);
+    EXPECT_EQ(target.back(), 7);
+
+    target.clear();
+    EXPECT_TRUE(target.empty());
+    target.push_back(1);
+    EXPECT_EQ(target.front(), 1);
+}
+
+struct Summer
+{
+    Summer() : total_(0) {}
+    void operator()(const int value) { total_ += value; }
+    int total_;
+};
+
+struct Doubler
+{
+    void operator()(int& value) const { value *= 2; }
+};
+
+struct WidePayload
+{
+    WidePayload(const int key = 0) : key_(key) {}
+    int key_;
+    char padding_[200];
+};
+
+TEST(ListTest, PrefetchingTraversalVisitsEveryElement)
+{
+    int a[] = {1, 2, 3, 4, 5, 6, 7};
+    List<int> list(a, a + 7);
+
+    EXPECT_EQ(list.for_each(Summer()).total_, 28);
+    EXPECT_EQ(list.for_each(Summer(), 0).total_, 28);
+    EXPECT_EQ(list.for_each(Summer(), 100).total_, 28);
+    list.for_each(Doubler());
+    EXPECT_EQ(list.accumulate(0), 56);
+    EXPECT_EQ(list.accumulate(1, std::multiplies<int>()), 645120);
+
+    List<int>::iterator found = list.find_if(IsMultipleOf(3));
+    ASSERT_TRUE(found != list.end());
+    EXPECT_EQ(*found, 6);
+    const List<int>& view = list;
+    EXPECT_TRUE(view.find_if(IsMultipleOf(100)) == view.end());
+
+    List<WidePayload> wide;
+    for (int i = 0; i < 10; ++i) {
+        wide.push_back(WidePayload(i));
+    }
+    int expected = 0;
+    for (List<WidePayload>::const_prefetch_iterator it = wide.prefetch_begin(3); it != wide.prefetch_end(); ++it) {
+        EXPECT_EQ(it->data_.key_, expected++);
+    }
+    EXPECT_EQ(expected, 10);
+
+    List<int> empty;
+    EXPECT_TRUE(empty.prefetch_begin() == empty.prefetch_end());
+    EXPECT_EQ(empty.accumulate(7), 7);
+}
+
+// ======== ConcurrentList ========
+struct NotLessThan
+{
+    explicit NotLessThan(const int bound) : bound_(bound) {}
+    bool operator()(const int value) const { return value >= bound_; }
+    int bound_;
+};
+
+TEST(ConcurrentListTest, SequentialOperations)
+{
+    ConcurrentList<int> list;
+    int value = 0;
+    EXPECT_FALSE(list.pop_front(value));
+    EXPECT_FALSE(list.pop_back(value));
+
+    list.push_back(3);
+    list.push_front(1);
+    list.insert(NotLessThan(2), 2);
+    list.insert(NotLessThan(10), 4);
+    EXPECT_EQ(list.size(), 4u);
+    EXPECT_TRUE(list.find(2));
+    EXPECT_FALSE(list.find(5));
+    EXPECT_EQ(list.for_each(Summer()).total_, 10);
+
+    EXPECT_TRUE(list.erase(3));
+    EXPECT_FALSE(list.erase(3));
+    EXPECT_TRUE(list.find_if(IsEven(), value));
+    EXPECT_EQ(value, 2);
+
+    EXPECT_TRUE(list.pop_back(value));
+    EXPECT_EQ(value, 4);
+    EXPECT_TRUE(list.pop_front(value));
+    EXPECT_EQ(value, 1);
+    list.clear();
+    EXPECT_TRUE(list.empty());
+}
+
+struct ConcurrentWorker
+{
+    ConcurrentList<int>* list_;
+    int base_;
+    long popped_;
+};
+
+static const int CONCURRENT_PER_THREAD = 2000;
+
+static void*
+fillAndErase(void* argument)
+{
+    ConcurrentWorker* worker = static_cast<ConcurrentWorker*>(argument);
+    for (int i = 0; i < CONCURRENT_PER_THREAD; ++i) {
+        const int value = worker->base_ + i;
+        switch (i % 3) {
+        case 0:  worker->list_->push_back(value);  break;
+        case 1:  worker->list_->push_front(value); break;
+        default: worker->list_->insert(NotLessThan(value), value); break;
+        }
+    }
+    for (int i = 0; i < CONCURRENT_PER_THREAD; i += 2) {
+        worker->list_->erase(worker->base_ + i);
+    }
+    return NULL;
+}
+
+static void*
+drainBothEnds(void* argument)
+{
+    ConcurrentWorker* worker = static_cast<ConcurrentWorker*>(argument);
+    int value = 0;
+    for (bool front = true; front ? worker->list_->pop_front(value) : worker->list_->pop_back(value); front = !front) {
+        worker->popped_ += value;
+    }
+    return NULL;
+}
+
+TEST(ConcurrentListTest, ParallelMutatorsKeepTheListConsistent)
+{
+    ConcurrentList<int> list;
+    ConcurrentWorker workers[4];
+    pthread_t threads[4];
+    for (int i = 0; i < 4; ++i) {
+        workers[i].list_ = &list;
+        workers[i].base_ = i * CONCURRENT_PER_THREAD;
+        workers[i].popped_ = 0;
+        pthread_create(&threads[i], NULL, fillAndErase, &workers[i]);
+    }
+    long expected = 0;
+    for (int i = 0; i < 4; ++i) {
+        pthread_join(threads[i], NULL);
+        for (int j = 1; j < CONCURRENT_PER_THREAD; j += 2) {
+            expected += workers[i].base_ + j;
+        }
+    }
+    EXPECT_EQ(list.size(), 4u * CONCURRENT_PER_THREAD / 2);
+    EXPECT_EQ(list.for_each(Summer()).total_, expected);
+    EXPECT_FALSE(list.find(0));
+    EXPECT_TRUE(list.find(1));
+
+    for (int i = 0; i < 4; ++i) {
+        pthread_create(&threads[i], NULL, drainBothEnds, &workers[i]);
+    }
+    long popped = 0;
+    for (int i = 0; i < 4; ++i) {
+        pthread_join(threads[i], NULL);
+        popped += workers[i].popped_;
+    }
+    EXPECT_EQ(popped, expected);
+    EXPECT_TRUE(list.empty());
+}
+
+// ======== LockFreeList ========
+TEST(LockFreeListTest, SortedSetSemantics)
+{
+    LockFreeList<int> set;
+    EXPECT_TRUE(set.empty());
+    EXPECT_TRUE(set.insert(5));
+    EXPECT_TRUE(set.insert(1));
+    EXPECT_TRUE(set.insert(3));
+    EXPECT_FALSE(set.insert(3));
+    EXPECT_EQ(set.size(), 3u);
+    EXPECT_TRUE(set.contains(1));
+    EXPECT_TRUE(set.contains(5));
+    EXPECT_FALSE(set.contains(4));
+
+    EXPECT_TRUE(set.erase(3));
+    EXPECT_FALSE(set.erase(3));
+    EXPECT_FALSE(set.contains(3));
+    EXPECT_TRUE(set.insert(3));
+    EXPECT_EQ(set.size(), 3u);
+
+    LockFreeList<std::string, std::greater<std::string> > words;
+    words.insert("b");
+    words.insert("c");
+    EXPECT_TRUE(words.contains("c"));
+    EXPECT_TRUE(words.erase("b"));
+    EXPECT_EQ(words.size(), 1u);
+}
+
+struct LockFreeWorker
+{
+    LockFreeList<int>* set_;
+    unsigned seed_;
+    long inserted_;
+    long erased_;
+};
+
+static const int LOCK_FREE_KEYS = 64;
+
+/// every thread fights over the same small key range
+static void*
+churnLockFreeSet(void* argument)
+{
+    LockFreeWorker* worker = static_cast<LockFreeWorker*>(argument);
+    for (int i = 0; i < 20000; ++i) {
+        worker->seed_ = worker->seed_ * 1103515245u + 12345u;
+        const int key = static_cast<int>((worker->seed_ >> 16) % LOCK_FREE_KEYS);
+        switch ((worker->seed_ >> 8) % 4) {
+        case 0:  worker->inserted_ += worker->set_->insert(key); break;
+        case 1:  worker->erased_ += worker->set_->erase(key);    break;
+        default: worker->set_->contains(key);                     break;
+        }
+    }
+    return NULL;
+}
+
+TEST(LockFreeListTest, StressKeepsInsertsAndErasesBalanced)
+{
+    LockFreeList<int> set;
+    LockFreeWorker workers[4];
+    pthread_t threads[4];
+    for (int i = 0; i < 4; ++i) {
+        workers[i].set_ = &set;
+        workers[i].seed_ = 17u * (i + 1);
+        workers[i].inserted_ = 0;
+        workers[i].erased_ = 0;
+        pthread_create(&threads[i], NULL, churnLockFreeSet, &workers[i]);
+    }
+    long balance = 0;
+    for (int i = 0; i < 4; ++i) {
+        pthread_join(threads[i], NULL);
+        balance += workers[i].inserted_ - workers[i].erased_;
+    }
+    size_t present = 0;
+    for (int key = 0; key < LOCK_FREE_KEYS; ++key) {
+        present += set.contains(key);
+    }
+    EXPECT_EQ(static_cast<long>(present), balance);
+    EXPECT_EQ(set.size(), present);
+}
+
+// ======== Queues ========
+TEST(MpscQueueTest, PopAndDrainKeepFifoOrder)
+{
+    MpscQueue<int> queue;
+    int value = 0;
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.pop(value));
+
+    queue.push(1);
+    {
+        MpscQueue<int>::Producer producer(queue);
+        producer.push(2);
+        producer.push(3);
+    }
+    EXPECT_TRUE(queue.pop(value));
+    EXPECT_EQ(value, 1);
+
+    MpscQueue<int>::Producer producer(queue);
+    producer.push(4);
+    List<int> batch;
+    batch.push_back(0);
+    EXPECT_EQ(queue.drain_into(batch), 3u);
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(batch.size(), 4u);
+    EXPECT_EQ(batch.accumulate(0), 9);
+    EXPECT_EQ(batch.back(), 4);
+    EXPECT_EQ(batch.at(1), 2);
+
+    producer.push(5);
+    EXPECT_TRUE(queue.pop(value));
+    EXPECT_EQ(value, 5);
+    EXPECT_EQ(queue.drain_into(batch), 0u);
+}
+
+struct QueueProducer
+{
+    MpscQueue<int>* queue_;
+    int id_;
+};
+
+static const int QUEUE_ITEMS = 5000;
+
+static void*
+produceInto(void* argument)
+{
+    QueueProducer* producer = static_cast<QueueProducer*>(argument);
+    if (producer->id_ % 2 != 0) {
+        MpscQueue<int>::Producer handle(*producer->queue_);
+        for (int i = 0; i < QUEUE_ITEMS; ++i) handle.push(producer->id_ * QUEUE_ITEMS + i);
+    } else {
+        for (int i = 0; i < QUEUE_ITEMS; ++i) producer->queue_->push(producer->id_ * QUEUE_ITEMS + i);
+    }
+    return NULL;
+}
+
+TEST(MpscQueueTest, ProducersKeepTheirOwnOrder)
+{
+    MpscQueue<int> queue;
+    QueueProducer producers[4];
+    pthread_t threads[4];
+    for (int i = 0; i < 4; ++i) {
+        producers[i].queue_ = &queue;
+        producers[i].id_ = i;
+        pthread_create(&threads[i], NULL, produceInto, &producers[i]);
+    }
+
+    int next[4] = {0, 0, 0, 0};
+    int received = 0;
+    List<int> batch;
+    while (received < 4 * QUEUE_ITEMS) {
+        int value = 0;
+        if (received % 3 == 0) {
+            queue.drain_into(batch);
+        } else if (queue.pop(value)) {
+            batch.push_back(value);
+        }
+        while (!batch.empty()) {
+            const int id = batch.front() / QUEUE_ITEMS;
+            EXPECT_EQ(batch.front() % QUEUE_ITEMS, next[id]++);
+            batch.pop_front();
+            ++received;
+        }
+    }
+    for (int i = 0; i < 4; ++i) {
+        pthread_join(threads[i], NULL);
+    }
+    EXPECT_TRUE(queue.empty());
+}
+
+static void*
+produceSpsc(void* argument)
+{
+    SpscQueue<int>* queue = static_cast<SpscQueue<int>*>(argument);
+    for (int i = 0; i < 4 * QUEUE_ITEMS; ++i) {
+        queue->push(i);
+    }
+    return NULL;
+}
+
+TEST(SpscQueueTest, DeliversInOrderThroughPopAndDrain)
+{
+    SpscQueue<int> queue;
+    int value = 0;
+    EXPECT_FALSE(queue.pop(value));
+    queue.push(7);
+    List<int> single;
+    EXPECT_EQ(queue.drain_into(single), 1u);
+    EXPECT_EQ(single.front(), 7);
+    EXPECT_TRUE(queue.empty());
+
+    pthread_t thread;
+    pthread_create(&thread, NULL, produceSpsc, &queue);
+    int expected = 0;
+    List<int> batch;
+    while (expected < 4 * QUEUE_ITEMS) {
+        if (expected % 2 == 0) {
+            queue.drain_into(batch);
+        } else if (queue.pop(value)) {
+            batch.push_back(value);
+        }
+        for ( ; !batch.empty(); batch.pop_front()) {
+            EXPECT_EQ(batch.front(), expected++);
+        }
+    }
+    pthread_join(thread, NULL);
+    EXPECT_TRUE(queue.empty());
+}
+
+// ======== RcuList ========
+TEST(RcuListTest, WriterOperations)
+{
+    RcuList<int> list;
+    list.push_back(2);
+    list.push_front(1);
+    list.push_back(4);
+    list.insert(NotLessThan(3), 3);
+    EXPECT_EQ(list.size(), 4u);
+
+    RcuList<int>::Reader reader(list);
+    reader.lock();
+    int expected = 1;
+    for (RcuList<int>::const_iterator it = list.begin(); it != list.end(); ++it) {
+        EXPECT_EQ(*it, expected++);
+    }
+    reader.unlock();
+
+    EXPECT_TRUE(list.erase(4));
+    EXPECT_FALSE(list.erase(4));
+    list.push_back(5);
+    EXPECT_TRUE(list.replace_if(IsEven(), 20));
+    list.synchronize();
+
+    reader.lock();
+    RcuList<int>::const_iterator it = list.begin();
+    EXPECT_EQ(*it++, 1);
+    EXPECT_EQ(*it++, 20);
+    EXPECT_EQ(*it++, 3);
+    EXPECT_EQ(*it++, 5);
+    EXPECT_TRUE(it == list.end());
+    reader.unlock();
+
+    list.clear();
+    EXPECT_TRUE(list.empty());
+    list.push_back(6);
+    EXPECT_EQ(*list.begin(), 6);
+}
+
+struct RcuReaderState
+{
+    const RcuList<int>* list_;
+    volatile int* stop_;
+    long passes_;
+    long errors_;
+};
+
+/// the writer keeps the multiples of 10 below 500 sorted; a reader that
+/// stalls on an unlinked node may miss re-inserts, never see disorder
+static void*
+readRcuList(void* argument)
+{
+    RcuReaderState* state = static_cast<RcuReaderState*>(argument);
+    RcuList<int>::Reader reader(*state->list_);
+    while (0 == __atomic_load_n(state->stop_, __ATOMIC_ACQUIRE) || state->passes_ < 10) {
+        reader.lock();
+        int previous = -1;
+        for (RcuList<int>::const_iterator it = state->list_->begin(); it != state->list_->end(); ++it) {
+            state->errors_ += (*it <= previous || *it % 10 != 0 || *it >= 500);
+            previous = *it;
+        }
+        reader.unlock();
+        ++state->passes_;
+    }
+    return NULL;
+}
+
+TEST(RcuListTest, ReadersSeeConsistentSnapshotsDuringUpdates)
+{
+    RcuList<int> list;
+    for (int i = 0; i < 50; ++i) {
+        list.push_back(i * 10);
+    }
+    volatile int stop = 0;
+    RcuReaderState states[3];
+    pthread_t threads[3];
+    for (int i = 0; i < 3; ++i) {
+        states[i].list_ = &list;
+        states[i].stop_ = &stop;
+        states[i].passes_ = 0;
+        states[i].errors_ = 0;
+        pthread_create(&threads[i], NULL, readRcuList, &states[i]);
+    }
+    for (int round = 0; round < 2000; ++round) {
+        const int slot = (round * 7) % 50;
+        list.erase_if(NotLessThan(slot * 10));
+        list.insert(NotLessThan(slot * 10), slot * 10);
+        list.replace_if(NotLessThan(((round * 3) % 50) * 10), ((round * 3) % 50) * 10);
+    }
+    __atomic_store_n(&stop, 1, __ATOMIC_RELEASE);
+    for (int i = 0; i < 3; ++i) {
+        pthread_join(threads[i], NULL);
+        EXPECT_EQ(states[i].errors_, 0);
+        EXPECT_GE(states[i].passes_, 10);
+    }
+    list.synchronize();
+    EXPECT_EQ(list.size(), 50u);
+}
+
+// ======== ShardedList ========
+struct ShardedAppender
+{
+    ShardedList<int>* list_;
+    int base_;
+};
+
+static void*
+appendToShards(void* argument)
+{
+    ShardedAppender* appender = static_cast<ShardedAppender*>(argument);
+    for (int i = 0; i < 1000; ++i) {
+        appender->list_->push_back(appender->base_ + i);
+    }
+    return NULL;
+}
+
+TEST(ShardedListTest, ThreadsAppendToTheirOwnShardsAndDrainInOrder)
+{
+    ShardedList<int> list(4);
+    EXPECT_EQ(list.shards(), 4u);
+    EXPECT_TRUE(list.begin() == list.end());
+
+    ShardedAppender appenders[4];
+    pthread_t threads[4];
+    for (int i = 0; i < 4; ++i) {
+        appenders[i].list_ = &list;
+        appenders[i].base_ = i * 1000;
+        pthread_create(&threads[i], NULL, appendToShards, &appenders[i]);
+    }
+    for (int i = 0; i < 4; ++i) {
+        pthread_join(threads[i], NULL);
+    }
+    EXPECT_EQ(list.size(), 4000u);
+
+    int next[4] = {0, 0, 0, 0};
+    long sum = 0;
+    for (ShardedList<int>::const_iterator it = list.begin(); it != list.end(); ++it) {
+        EXPECT_EQ(*it % 1000, next[*it / 1000]++);
+        sum += *it;
+    }
+    EXPECT_EQ(sum, 3999L * 4000L / 2);
+
+    List<int> merged;
+    merged.push_back(-1);
+    EXPECT_EQ(list.drain_into(merged), 4000u);
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(merged.size(), 4001u);
+    EXPECT_EQ(merged.front(), -1);
+
+    list.push_back(5);
+    EXPECT_EQ(*list.begin(), 5);
+    list.clear();
+    EXPECT_TRUE(list.begin() == list.end());
+}
+
+static void*
+appendOneShort(void* argument)
+{
+    ShardedList<short>* list = static_cast<ShardedList<short>*>(argument);
+    list->push_back(static_cast<short>(list->size() + 1));
+    return NULL;
+}
+
+TEST(ShardedListTest, ExitedThreadsHandTheirShardBack)
+{
+    ShardedList<short> list(2);
+    for (int i = 0; i < 5; ++i) {
+        pthread_t thread;
+        pthread_create(&thread, NULL, appendOneShort, &list);
+        pthread_join(thread, NULL);
+    }
+    EXPECT_EQ(list.size(), 5u);
+    EXPECT_FALSE(list.empty());
+
+    /// every thread reused the first number, so all five share one shard
+    short expected = 1;
+    for (ShardedList<short>::const_iterator it = list.begin(); it != list.end(); ++it) {
+        EXPECT_EQ(*it, expected++);
+    }
+    EXPECT_EQ(expected, 6);
+}
+
+// ======== Parallel algorithms ========
+struct AtomicSummer
+{
+    explicit AtomicSummer(long* total) : total_(total) {}
+    void operator()(const int value) const { __atomic_fetch_add(total_, value, __ATOMIC_RELAXED); }
+    long* total_;
+};
+
+TEST(ParallelListTest, MatchesSequentialResults)
+{
+    List<int> list;
+    for (int i = 0; i < 10000; ++i) {
+        list.push_back(i % 97);
+    }
+    ThreadPool pool(3);
+    const ParallelPolicy policy = par.on(pool).with_grain(64);
+
+    size_t evens = 0;
+    for (List<int>::const_iterator it = list.begin(); it != list.end(); ++it) {
+        evens += IsEven()(*it);
+    }
+    EXPECT_EQ(count_if(policy, list, IsEven()), evens);
+    EXPECT_EQ(accumulate(policy, list, 5), list.accumulate(5));
+    EXPECT_EQ(accumulate(policy, list, 0, std::plus<int>()), list.accumulate(0));
+
+    const List<int>& view = list;
+    List<int>::const_iterator found = find_if(policy, view, IsMultipleOf(96));
+    ASSERT_TRUE(found != view.end());
+    EXPECT_TRUE(found == list.find_if(IsMultipleOf(96)));
+    EXPECT_EQ(*found, 0);
+    List<int>::iterator late = find_if(policy, list, NotLessThan(96));
+    EXPECT_TRUE(late == list.find_if(NotLessThan(96)));
+    EXPECT_TRUE(find_if(policy, list, NotLessThan(1000)) == list.end());
+
+    long total = 0;
+    for_each(policy, view, AtomicSummer(&total));
+    EXPECT_EQ(total, static_cast<long>(list.accumulate(0)));
+    for_each(policy, list, Doubler());
+    EXPECT_EQ(accumulate(policy, list, 0), 2 * static_cast<int>(total));
+
+    List<int> small(3, 1);
+    EXPECT_EQ(count_if(par, small, IsEven()), 0u);
+    EXPECT_EQ(accumulate(par, List<int>(), 7), 7);
+}
+
+struct NestedSum
+{
+    ThreadPool* pool_;
+    long values_[8];
+    long total_;
+};
+
+static void
+addOne(void* argument)
+{
+    __atomic_fetch_add(static_cast<long*>(argument), 1L, __ATOMIC_RELAXED);
+}
+
+static void
+spawnNested(void* argument)
+{
+    NestedSum* sum = static_cast<NestedSum*>(argument);
+    ThreadPool::TaskGroup group(*sum->pool_);
+    for (int i = 0; i < 8; ++i) {
+        group.run(addOne, &sum->values_[i]);
+    }
+    group.wait();
+    for (int i = 0; i < 8; ++i) {
+        sum->total_ += sum->values_[i];
+    }
+}
+
+TEST(ThreadPoolTest, NestedGroupsDoNotDeadlock)
+{
+    ThreadPool pool(2);
+    NestedSum sums[4];
+    ThreadPool::TaskGroup group(pool);
+    for (int i = 0; i < 4; ++i) {
+        sums[i].pool_ = &pool;
+        sums[i].total_ = 0;
+        for (int j = 0; j < 8; ++j) sums[i].values_[j] = 0;
+        group.run(spawnNested, &sums[i]);
+    }
+    group.wait();
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_EQ(sums[i].total_, 8);
+    }
+}
+
+TEST(ParallelListTest, StructuralRemoveIfAndPartitionMatchSequential)
+{
+    List<int> source;
+    for (int i = 0; i < 5000; ++i) {
+        source.push_back((i * 37) % 1000);
+    }
+    ThreadPool pool(3);
+    const ParallelPolicy policy = par.on(pool).with_grain(50);
+
+    List<int> parallel(source);
+    List<int> sequential(source);
+    EXPECT_EQ(parallel.remove_if(policy, IsMultipleOf(3)), sequential.remove_if(IsMultipleOf(3)));
+    EXPECT_TRUE(parallel == sequential);
+    EXPECT_EQ(parallel.size(), sequential.size());
+    EXPECT_EQ(parallel.back(), sequential.back());
+    parallel.push_front(-1);
+    EXPECT_EQ(parallel.front(), -1);
+
+    parallel = source;
+    sequential = source;
+    List<int>::iterator split = parallel.partition(policy, IsEven());
+    List<int>::iterator expected = sequential.stable_partition(IsEven());
+    EXPECT_TRUE(parallel == sequential);
+    EXPECT_EQ(*split, *expected);
+    --split;
+    EXPECT_TRUE(IsEven()(*split));
+
+    List<int> odd(4, 1);
+    EXPECT_EQ(odd.remove_if(policy, IsEven()), 0u);
+    EXPECT_TRUE(odd.partition(policy, IsEven()) == odd.begin());
+    EXPECT_EQ(odd.remove_if(par, IsMultipleOf(1)), 4u);
+    EXPECT_TRUE(odd.empty());
+    EXPECT_TRUE(odd.partition(par, IsEven()) == odd.end());
+}
+
+typedef NodeAllocator<136> SmallBlocks;
+
+static void*
+freeBlocks(void* argument)
+{
+    std::vector<void*>& blocks = *static_cast<std::vector<void*>*>(argument);
+    for (size_t i = 0; i < blocks.size(); ++i) {
+        SmallBlocks::deallocate(blocks[i]);
+    }
+    return NULL;
+}
+
+TEST(NodeAllocatorTest, RemoteFreesReturnToTheOwningThread)
+{
+    void* first = SmallBlocks::allocate();
+    EXPECT_EQ(reinterpret_cast<size_t>(first) % 16, 0u);
+    SmallBlocks::deallocate(first);
+    EXPECT_EQ(SmallBlocks::allocate(), first);
+
+    std::vector<void*> blocks(1, first);
+    for (int i = 1; i < 200; ++i) {
+        blocks.push_back(SmallBlocks::allocate());
+        *static_cast<int*>(blocks.back()) = i;
+    }
+    pthread_t consumer;
+    pthread_create(&consumer, NULL, freeBlocks, &blocks);
+    pthread_join(consumer, NULL);
+
+    /// whatever is left of the local slabs goes first, then the returned batch
+    std::vector<void*> reused;
+    for (size_t i = 0; i < blocks.size() + SmallBlocks::SLAB; ++i) {
+        reused.push_back(SmallBlocks::allocate());
+    }
+    std::sort(blocks.begin(), blocks.end());
+    std::sort(reused.begin(), reused.end());
+    EXPECT_TRUE(std::includes(reused.begin(), reused.end(), blocks.begin(), blocks.end()));
+    freeBlocks(&reused);
+}
+
+struct Tracked
+{
+    static volatile int alive;
+    Tracked() { Atomic::fetchAdd(&alive, 1); }
+    Tracked(const Tracked&) { Atomic::fetchAdd(&alive, 1); }
+    ~Tracked() { Atomic::fetchAdd(&alive, -1); }
+};
+volatile int Tracked::alive = 0;
+
+TEST(ReclaimerTest, ReleaseAsyncFreesDetachedChainsInBatches)
+{
+    Reclaimer reclaimer(7);
+    List<Tracked> first(1000);
+    List<Tracked> second(500);
+    List<Tracked> empty;
+    const int sentinels = Atomic::load(&Tracked::alive) - 1500;
+
+    first.release_async(reclaimer);
+    second.release_async(reclaimer);
+    EXPECT_TRUE(first.empty());
+    EXPECT_EQ(first.size(), 0u);
+    first.push_back(Tracked());
+    EXPECT_EQ(first.size(), 1u);
+
+    reclaimer.drain();
+    EXPECT_EQ(reclaimer.pending(), 0u);
+    EXPECT_EQ(Atomic::load(&Tracked::alive), sentinels + 1);
+
+    empty.release_async(reclaimer);
+    first.release_async();
+    Reclaimer::instance().drain();
+    EXPECT_EQ(Atomic::load(&Tracked::alive), sentinels);
+}
+
+TEST(MutationBatchTest, ApplyMatchesOriginalPositions)
+{
+    List<int> list;
+    for (int i = 0; i < 10; ++i) {
+        list.push_back(i);
+    }
+    List<int>::iterator third = list.begin();
+    ++third;
+    ++third;
+
+    MutationBatch<int> batch;
+    batch.erase(9);
+    batch.insert(10, 100);
+    batch.insert(third, 20);
+    batch.insert(2, 21);
+    batch.erase(third);
+    batch.erase(0);
+    batch.insert(0, -1);
+    batch.insert(list.end(), 101);
+    batch.erase(5);
+    EXPECT_EQ(batch.size(), 9u);
+
+    EXPECT_EQ(list.size(), 10u);
+    EXPECT_TRUE(list.apply(batch));
+    const int expected[] = { -1, 1, 20, 21, 3, 4, 6, 7, 8, 100, 101 };
+    EXPECT_EQ(list.size(), 11u);
+    List<int>::const_iterator it = list.begin();
+    for (size_t i = 0; i < sizeof(expected) / sizeof(*expected); ++i, ++it) {
+        EXPECT_EQ(*it, expected[i]);
+    }
+    EXPECT_TRUE(it == list.end());
+    EXPECT_EQ(list.back(), 101);
+    EXPECT_EQ(list.front(), -1);
+
+    batch.clear();
+    EXPECT_TRUE(batch.empty());
+    list.apply(batch);
+    EXPECT_EQ(list.size(), 11u);
+
+    List<int> empty;
+    batch.insert(0, 5);
+    batch.insert(0, 6);
+    empty.apply(batch);
+    EXPECT_EQ(empty.front(), 5);
+    EXPECT_EQ(empty.back(), 6);
+    EXPECT_EQ(empty.size(), 2u);
+}
+
+struct ThrowingCopy
+{
+    static int copiesLeft;
+    int value_;
+    ThrowingCopy(int value = 0) : value_(value) {}
+    ThrowingCopy(const ThrowingCopy& rhv) : value_(rhv.value_)
+    {
+        if (copiesLeft-- == 0) throw value_;
+    }
+};
+int ThrowingCopy::copiesLeft = -1;
+
+TEST(MutationBatchTest, RejectedOrFailedBatchesLeaveTheListAlone)
+{
+    List<int> list(3, 1);
+    MutationBatch<int> batch;
+    batch.insert(1, 7);
+    batch.insert(4, 8);
+    EXPECT_FALSE(list.apply(batch));
+    EXPECT_EQ(list.size(), 3u);
+
+    batch.clear();
+    batch.insert(0, 7);
+    batch.erase(3);
+    EXPECT_FALSE(list.apply(batch));
+
+    batch.clear();
+    batch.erase(list.end());
+    EXPECT_FALSE(list.apply(batch));
+    EXPECT_EQ(list.size(), 3u);
+    EXPECT_EQ(list.front(), 1);
+
+    batch.clear();
+    batch.insert(3, 9);
+    EXPECT_TRUE(list.apply(batch));
+    EXPECT_EQ(list.back(), 9);
+
+    List<ThrowingCopy> throwing(2, ThrowingCopy(1));
+    MutationBatch<ThrowingCopy> failing;
+    for (int i = 0; i < 4; ++i) {
+        failing.insert(i % 3, ThrowingCopy(i));
+    }
+    ThrowingCopy::copiesLeft = 2;
+    EXPECT_THROW(throwing.apply(failing), int);
+    ThrowingCopy::copiesLeft = -1;
+    EXPECT_EQ(throwing.size(), 2u);
+    EXPECT_EQ(throwing.front().value_, 1);
+}
+
 int
 main(int argc, char **argv)
 {
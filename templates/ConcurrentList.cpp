@@ -0,0 +1,288 @@
+#include "../headers/ConcurrentList.hpp"
+#include "../headers/Atomic.hpp"
+#include <cstddef>
+#include <sched.h>
+
+template <typename T>
+ConcurrentList<T>::ConcurrentList()
+    : head_(new Node())
+    , tail_(new Node(T(), head_, NULL))
+    , size_(0)
+{
+    head_->next_ = tail_;
+}
+
+template <typename T>
+ConcurrentList<T>::~ConcurrentList()
+{
+    while (head_ != NULL) {
+        Node* next = head_->next_;
+        delete head_;
+        head_ = next;
+    }
+}
+
+template <typename T>
+void
+ConcurrentList<T>::push_front(const_reference value)
+{
+    Node* node = new Node(value);
+    head_->lock();
+    Node* next = head_->next_;
+    next->lock();
+    link(head_, node, next);
+    next->unlock();
+    head_->unlock();
+}
+
+template <typename T>
+void
+ConcurrentList<T>::push_back(const_reference value)
+{
+    Node* node = new Node(value);
+    Node* last = lockLast();
+    link(last, node, tail_);
+    last->unlock();
+    tail_->unlock();
+}
+
+template <typename T>
+bool
+ConcurrentList<T>::pop_front(reference value)
+{
+    head_->lock();
+    Node* first = head_->next_;
+    if (first == tail_) {
+        head_->unlock();
+        return false;
+    }
+    first->lock();
+    Node* next = first->next_;
+    next->lock();
+    value = first->data_;
+    unlink(head_, first, next);
+    next->unlock();
+    first->unlock();
+    head_->unlock();
+    delete first;
+    return true;
+}
+
+template <typename T>
+bool
+ConcurrentList<T>::pop_back(reference value)
+{
+    Node* last = NULL;
+    Node* previous = NULL;
+    for (;;) {
+        tail_->lock();
+        last = tail_->previous_;
+        if (last == head_) {
+            tail_->unlock();
+            return false;
+        }
+        if (last->tryLock()) {
+            /// last cannot be unlinked while its successor is held, so its
+            /// predecessor pointer is stable
+            previous = last->previous_;
+            if (previous->tryLock()) {
+                break;
+            }
+            last->unlock();
+        }
+        tail_->unlock();
+        backOff();
+    }
+    value = last->data_;
+    unlink(previous, last, tail_);
+    previous->unlock();
+    last->unlock();
+    tail_->unlock();
+    delete last;
+    return true;
+}
+
+/// Inserts before the first element for which before() holds, or at the back.
+template <typename T>
+template <typename Predicate>
+void
+ConcurrentList<T>::insert(Predicate before, const_reference value)
+{
+    Node* node = new Node(value);
+    Node* previous = head_;
+    previous->lock();
+    Node* current = previous->next_;
+    current->lock();
+    while (current != tail_ && !before(current->data_)) {
+        previous->unlock();
+        previous = current;
+        current = current->next_;
+        current->lock();
+    }
+    link(previous, node, current);
+    current->unlock();
+    previous->unlock();
+}
+
+template <typename T>
+bool
+ConcurrentList<T>::erase(const_reference value)
+{
+    return erase_if(EqualTo(value));
+}
+
+/// Erases the first element for which predicate() holds.
+template <typename T>
+template <typename Predicate>
+bool
+ConcurrentList<T>::erase_if(Predicate predicate)
+{
+    Node* previous = head_;
+    previous->lock();
+    Node* current = previous->next_;
+    current->lock();
+    while (current != tail_) {
+        if (predicate(current->data_)) {
+            Node* next = current->next_;
+            next->lock();
+            unlink(previous, current, next);
+            next->unlock();
+            current->unlock();
+            previous->unlock();
+            delete current;
+            return true;
+        }
+        previous->unlock();
+        previous = current;
+        current = current->next_;
+        current->lock();
+    }
+    current->unlock();
+    previous->unlock();
+    return false;
+}
+
+template <typename T>
+bool
+ConcurrentList<T>::find(const_reference value) const
+{
+    T found;
+    return find_if(EqualTo(value), found);
+}
+
+/// Readers hold one node at a time, locking the next before releasing it.
+template <typename T>
+template <typename Predicate>
+bool
+ConcurrentList<T>::find_if(Predicate predicate, reference found) const
+{
+    Node* current = head_;
+    current->lock();
+    for (;;) {
+        Node* next = current->next_;
+        next->lock();
+        current->unlock();
+        current = next;
+        if (current == tail_) {
+            break;
+        }
+        if (predicate(current->data_)) {
+            found = current->data_;
+            current->unlock();
+            return true;
+        }
+    }
+    current->unlock();
+    return false;
+}
+
+template <typename T>
+template <typename Function>
+Function
+ConcurrentList<T>::for_each(Function function)
+{
+    Node* current = head_;
+    current->lock();
+    for (;;) {
+        Node* next = current->next_;
+        next->lock();
+        current->unlock();
+        current = next;
+        if (current == tail_) {
+            break;
+        }
+        function(current->data_);
+    }
+    current->unlock();
+    return function;
+}
+
+template <typename T>
+typename ConcurrentList<T>::size_type
+ConcurrentList<T>::size() const
+{
+    return Atomic::load(&size_);
+}
+
+template <typename T>
+bool
+ConcurrentList<T>::empty() const
+{
+    return 0 == size();
+}
+
+template <typename T>
+void
+ConcurrentList<T>::clear()
+{
+    T value;
+    while (pop_front(value)) {}
+}
+
+/// Callers hold the locks of all three nodes.
+template <typename T>
+void
+ConcurrentList<T>::link(Node* previous, Node* node, Node* next)
+{
+    node->previous_ = previous;
+    node->next_ = next;
+    previous->next_ = node;
+    next->previous_ = node;
+    Atomic::fetchAdd(&size_, static_cast<size_type>(1));
+}
+
+template <typename T>
+void
+ConcurrentList<T>::unlink(Node* previous, Node* node, Node* next)
+{
+    previous->next_ = next;
+    next->previous_ = previous;
+    node->previous_ = NULL;
+    node->next_ = NULL;
+    Atomic::fetchAdd(&size_, static_cast<size_type>(-1));
+}
+
+/// Returns the last element (or the head sentinel) locked together with the
+/// tail sentinel. The predecessor is taken against the lock order, so only
+/// by try-lock, and everything is released and retried on failure.
+template <typename T>
+typename ConcurrentList<T>::Node*
+ConcurrentList<T>::lockLast() const
+{
+    for (;;) {
+        tail_->lock();
+        Node* last = tail_->previous_;
+        if (last->tryLock()) {
+            return last;
+        }
+        tail_->unlock();
+        backOff();
+    }
+}
+
+template <typename T>
+void
+ConcurrentList<T>::backOff()
+{
+    ::sched_yield();
+}
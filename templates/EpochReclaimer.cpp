@@ -0,0 +1,205 @@
+#include "../headers/EpochReclaimer.hpp"
+#include "../headers/Atomic.hpp"
+#include <cstddef>
+#include <sched.h>
+
+template <typename T>
+EpochReclaimer<T>::EpochReclaimer()
+    : epoch_(0)
+    , records_(NULL)
+    , pending_(0)
+{
+    for (int i = 0; i < BUCKETS; ++i) {
+        retired_[i] = NULL;
+    }
+}
+
+/// No thread may be pinned any more.
+template <typename T>
+EpochReclaimer<T>::~EpochReclaimer()
+{
+    for (int i = 0; i < BUCKETS; ++i) {
+        destroy(retired_[i]);
+    }
+    while (records_ != NULL) {
+        Record* next = records_->next_;
+        delete records_;
+        records_ = next;
+    }
+}
+
+/// The caller must be pinned and must already have unlinked the object.
+template <typename T>
+void
+EpochReclaimer<T>::retire(T* object)
+{
+    /// read the epoch only after the unlink is visible to everybody
+    Atomic::fence();
+    const size_type epoch = Atomic::load(&epoch_);
+    Retired* retired = new Retired(object, Atomic::load(&retired_[epoch % BUCKETS]));
+    while (!Atomic::compareExchange(&retired_[epoch % BUCKETS], retired->next_, retired)) {}
+
+    if (0 == (Atomic::fetchAdd(&pending_, static_cast<size_type>(1)) + 1) % COLLECT_PERIOD) {
+        collect();
+    }
+}
+
+/// Advances the global epoch if every pinned thread has observed it and
+/// frees what was retired two epochs ago. Only call while pinned: that keeps
+/// the epoch from lapping this thread before it has emptied the bucket.
+template <typename T>
+bool
+EpochReclaimer<T>::collect()
+{
+    size_type epoch = Atomic::load(&epoch_);
+    Atomic::fence();
+    for (Record* record = Atomic::load(&records_); record != NULL; record = record->next_) {
+        const size_type state = Atomic::load(&record->state_);
+        if ((state & 1) != 0 && (state >> 1) != epoch) {
+            return false;
+        }
+    }
+    if (!Atomic::compareExchange(&epoch_, epoch, epoch + 1)) {
+        return false;
+    }
+
+    Retired* chain = Atomic::exchange(&retired_[(epoch + 2) % BUCKETS], static_cast<Retired*>(NULL));
+    size_type count = 0;
+    for (Retired* retired = chain; retired != NULL; retired = retired->next_) {
+        ++count;
+    }
+    destroy(chain);
+    Atomic::fetchAdd(&pending_, static_cast<size_type>(0) - count);
+    return true;
+}
+
+/// Grace period: returns once the epoch has moved two steps, so nothing
+/// retired before the call is reachable by any reader. Must not be called
+/// from inside a critical section of the same reclaimer.
+template <typename T>
+void
+EpochReclaimer<T>::synchronize()
+{
+    const size_type target = epoch() + 2;
+    while (epoch() < target) {
+        Guard guard(*this);
+        if (!collect()) {
+            ::sched_yield();
+        }
+    }
+}
+
+template <typename T>
+typename EpochReclaimer<T>::size_type
+EpochReclaimer<T>::epoch() const
+{
+    return Atomic::load(&epoch_);
+}
+
+/// Retired objects not yet freed.
+template <typename T>
+typename EpochReclaimer<T>::size_type
+EpochReclaimer<T>::pending() const
+{
+    return Atomic::load(&pending_);
+}
+
+/// Takes a free record or publishes a new one.
+template <typename T>
+typename EpochReclaimer<T>::Record*
+EpochReclaimer<T>::claim()
+{
+    Record* record = Atomic::load(&records_);
+    for ( ; record != NULL; record = record->next_) {
+        size_type free = 0;
+        if (0 == Atomic::loadRelaxed(&record->inUse_)
+                && Atomic::compareExchange(&record->inUse_, free, static_cast<size_type>(1))) {
+            return record;
+        }
+    }
+    record = new Record();
+    record->next_ = Atomic::load(&records_);
+    while (!Atomic::compareExchange(&records_, record->next_, record)) {}
+    return record;
+}
+
+/// Pins the current epoch in the record. The epoch is re-read after the
+/// announcement so that a concurrent collect() either sees this thread or
+/// this thread sees its new epoch.
+template <typename T>
+void
+EpochReclaimer<T>::announce(Record* record)
+{
+    for (;;) {
+        const size_type epoch = Atomic::load(&epoch_);
+        Atomic::store(&record->state_, (epoch << 1) | 1);
+        Atomic::fence();
+        if (Atomic::load(&epoch_) == epoch) {
+            return;
+        }
+    }
+}
+
+template <typename T>
+void
+EpochReclaimer<T>::release(Record* record)
+{
+    Atomic::store(&record->state_, static_cast<size_type>(0));
+    Atomic::store(&record->inUse_, static_cast<size_type>(0));
+}
+
+template <typename T>
+void
+EpochReclaimer<T>::destroy(Retired* chain)
+{
+    while (chain != NULL) {
+        Retired* next = chain->next_;
+        delete chain->object_;
+        delete chain;
+        chain = next;
+    }
+}
+
+///======================================GUARD===============================================
+
+template <typename T>
+EpochReclaimer<T>::Guard::Guard(EpochReclaimer<T>& reclaimer)
+    : reclaimer_(reclaimer)
+    , record_(reclaimer.claim())
+{
+    reclaimer_.announce(record_);
+}
+
+template <typename T>
+EpochReclaimer<T>::Guard::~Guard()
+{
+    reclaimer_.release(record_);
+}
+
+///======================================PARTICIPANT=========================================
+
+template <typename T>
+EpochReclaimer<T>::Participant::Participant(EpochReclaimer<T>& reclaimer)
+    : reclaimer_(reclaimer)
+    , record_(reclaimer.claim())
+{}
+
+template <typename T>
+EpochReclaimer<T>::Participant::~Participant()
+{
+    reclaimer_.release(record_);
+}
+
+template <typename T>
+void
+EpochReclaimer<T>::Participant::enter()
+{
+    reclaimer_.announce(record_);
+}
+
+template <typename T>
+void
+EpochReclaimer<T>::Participant::leave()
+{
+    Atomic::store(&record_->state_, static_cast<size_type>(0));
+}
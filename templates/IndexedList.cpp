@@ -0,0 +1,447 @@
+#include "../headers/IndexedList.hpp"
+#include <cstddef>
+#include <algorithm>
+
+template <typename T, typename Hash, typename Equal>
+IndexedList<T, Hash, Equal>::IndexedList(const Hash& hash, const Equal& equal)
+    : list_()
+    , buckets_(16, static_cast<Entry*>(NULL))
+    , size_(0)
+    , hash_(hash)
+    , equal_(equal)
+{}
+
+template <typename T, typename Hash, typename Equal>
+IndexedList<T, Hash, Equal>::IndexedList(const IndexedList& rhv)
+    : list_()
+    , buckets_(16, static_cast<Entry*>(NULL))
+    , size_(0)
+    , hash_(rhv.hash_)
+    , equal_(rhv.equal_)
+{
+    for (const_iterator it = rhv.begin(); it != rhv.end(); ++it) {
+        push_back(*it);
+    }
+}
+
+template <typename T, typename Hash, typename Equal>
+template <typename InputIterator>
+IndexedList<T, Hash, Equal>::IndexedList(InputIterator first, InputIterator last)
+    : list_()
+    , buckets_(16, static_cast<Entry*>(NULL))
+    , size_(0)
+    , hash_()
+    , equal_()
+{
+    for (InputIterator it = first; it != last; ++it) {
+        push_back(*it);
+    }
+}
+
+template <typename T, typename Hash, typename Equal>
+IndexedList<T, Hash, Equal>::~IndexedList()
+{
+    dropIndex();
+}
+
+template <typename T, typename Hash, typename Equal>
+IndexedList<T, Hash, Equal>&
+IndexedList<T, Hash, Equal>::operator=(const IndexedList& rhv)
+{
+    if (this != &rhv) {
+        clear();
+        for (const_iterator it = rhv.begin(); it != rhv.end(); ++it) {
+            push_back(*it);
+        }
+    }
+    return *this;
+}
+
+template <typename T, typename Hash, typename Equal>
+typename IndexedList<T, Hash, Equal>::const_iterator
+IndexedList<T, Hash, Equal>::insert(const_iterator position, const_reference value)
+{
+    ListIterator it = list_.insert(ListIterator(position.getPtr()), value);
+    indexNode(it.getPtr());
+    return it;
+}
+
+template <typename T, typename Hash, typename Equal>
+typename IndexedList<T, Hash, Equal>::const_iterator
+IndexedList<T, Hash, Equal>::erase(const_iterator position)
+{
+    unindexNode(position.getPtr());
+    return list_.erase(ListIterator(position.getPtr()));
+}
+
+template <typename T, typename Hash, typename Equal>
+void
+IndexedList<T, Hash, Equal>::push_back(const_reference value)
+{
+    list_.push_back(value);
+    indexNode(list_.end_->previous_);
+}
+
+template <typename T, typename Hash, typename Equal>
+void
+IndexedList<T, Hash, Equal>::push_front(const_reference value)
+{
+    list_.push_front(value);
+    indexNode(list_.begin_);
+}
+
+template <typename T, typename Hash, typename Equal>
+void
+IndexedList<T, Hash, Equal>::pop_back()
+{
+    if (empty()) return;
+
+    unindexNode(list_.end_->previous_);
+    list_.pop_back();
+}
+
+template <typename T, typename Hash, typename Equal>
+void
+IndexedList<T, Hash, Equal>::pop_front()
+{
+    if (empty()) return;
+
+    unindexNode(list_.begin_);
+    list_.pop_front();
+}
+
+template <typename T, typename Hash, typename Equal>
+typename IndexedList<T, Hash, Equal>::const_reference
+IndexedList<T, Hash, Equal>::front() const
+{
+    return list_.front();
+}
+
+template <typename T, typename Hash, typename Equal>
+typename IndexedList<T, Hash, Equal>::const_reference
+IndexedList<T, Hash, Equal>::back() const
+{
+    return list_.back();
+}
+
+/// Returns some element equal to value, not necessarily the first one in list order.
+template <typename T, typename Hash, typename Equal>
+typename IndexedList<T, Hash, Equal>::const_iterator
+IndexedList<T, Hash, Equal>::find(const_reference value) const
+{
+    Entry* entry = lookup(value);
+    return (entry != NULL ? const_iterator(entry->node_) : end());
+}
+
+template <typename T, typename Hash, typename Equal>
+bool
+IndexedList<T, Hash, Equal>::contains(const_reference value) const
+{
+    return lookup(value) != NULL;
+}
+
+template <typename T, typename Hash, typename Equal>
+typename IndexedList<T, Hash, Equal>::size_type
+IndexedList<T, Hash, Equal>::count(const_reference value) const
+{
+    const size_t hash = hash_(value);
+    size_type matches = 0;
+    for (Entry* entry = buckets_[ListHashing::scatter(hash) & (buckets_.size() - 1)]; entry != NULL; entry = entry->next_) {
+        if (entry->hash_ == hash && equal_(entry->node_->data_, value)) {
+            ++matches;
+        }
+    }
+    return matches;
+}
+
+template <typename T, typename Hash, typename Equal>
+typename IndexedList<T, Hash, Equal>::size_type
+IndexedList<T, Hash, Equal>::remove(const_reference value)
+{
+    const size_t hash = hash_(value);
+    std::vector<Node*> matches;
+
+    Entry** link = &buckets_[ListHashing::scatter(hash) & (buckets_.size() - 1)];
+    while (*link != NULL) {
+        Entry* entry = *link;
+        if (entry->hash_ == hash && equal_(entry->node_->data_, value)) {
+            *link = entry->next_;
+            matches.push_back(entry->node_);
+            delete entry;
+            --size_;
+            continue;
+        }
+        link = &entry->next_;
+    }
+
+    /// erase only after the scan, value may refer to one of the matches
+    for (typename std::vector<Node*>::size_type i = 0; i < matches.size(); ++i) {
+        list_.erase(ListIterator(matches[i]));
+    }
+    return matches.size();
+}
+
+template <typename T, typename Hash, typename Equal>
+void
+IndexedList<T, Hash, Equal>::splice(const_iterator position, IndexedList& rhv)
+{
+    if (&rhv == this) return;
+
+    adopt(rhv, rhv.list_.begin_, rhv.list_.end_);
+    list_.splice(ListIterator(position.getPtr()), rhv.list_);
+}
+
+template <typename T, typename Hash, typename Equal>
+void
+IndexedList<T, Hash, Equal>::splice(const_iterator position, IndexedList& rhv, const_iterator index)
+{
+    if (&rhv != this) {
+        adopt(rhv, index.getPtr(), index.getPtr()->next_);
+    }
+    list_.splice(ListIterator(position.getPtr()), rhv.list_, ListIterator(index.getPtr()));
+}
+
+template <typename T, typename Hash, typename Equal>
+void
+IndexedList<T, Hash, Equal>::splice(const_iterator position, IndexedList& rhv,
+                                    const_iterator first, const_iterator last)
+{
+    if (&rhv != this) {
+        adopt(rhv, first.getPtr(), last.getPtr());
+    }
+    list_.splice(ListIterator(position.getPtr()), rhv.list_,
+                 ListIterator(first.getPtr()), ListIterator(last.getPtr()));
+}
+
+template <typename T, typename Hash, typename Equal>
+typename IndexedList<T, Hash, Equal>::size_type
+IndexedList<T, Hash, Equal>::unique()
+{
+    if (empty()) return 0;
+
+    size_type removed = 0;
+    Node* kept = list_.begin_;
+    Node* node = kept->next_;
+    while (node != list_.end_) {
+        Node* next = node->next_;
+        if (equal_(kept->data_, node->data_)) {
+            unindexNode(node);
+            list_.erase(ListIterator(node));
+            ++removed;
+        } else {
+            kept = node;
+        }
+        node = next;
+    }
+    return removed;
+}
+
+template <typename T, typename Hash, typename Equal>
+void
+IndexedList<T, Hash, Equal>::merge(IndexedList& rhv)
+{
+    merge(rhv, std::less<T>());
+}
+
+template <typename T, typename Hash, typename Equal>
+template <typename BinaryPredicate>
+void
+IndexedList<T, Hash, Equal>::merge(IndexedList& rhv, BinaryPredicate comparison)
+{
+    if (&rhv == this) return;
+
+    adopt(rhv, rhv.list_.begin_, rhv.list_.end_);
+    list_.merge(rhv.list_, comparison);
+}
+
+template <typename T, typename Hash, typename Equal>
+void
+IndexedList<T, Hash, Equal>::sort()
+{
+    list_.sort();
+}
+
+template <typename T, typename Hash, typename Equal>
+template <typename BinaryPredicate>
+void
+IndexedList<T, Hash, Equal>::sort(BinaryPredicate comparison)
+{
+    list_.sort(comparison);
+}
+
+template <typename T, typename Hash, typename Equal>
+void
+IndexedList<T, Hash, Equal>::reverse()
+{
+    list_.reverse();
+}
+
+template <typename T, typename Hash, typename Equal>
+void
+IndexedList<T, Hash, Equal>::swap(IndexedList& rhv)
+{
+    list_.swap(rhv.list_);
+    buckets_.swap(rhv.buckets_);
+    std::swap(size_, rhv.size_);
+    std::swap(hash_, rhv.hash_);
+    std::swap(equal_, rhv.equal_);
+}
+
+template <typename T, typename Hash, typename Equal>
+typename IndexedList<T, Hash, Equal>::size_type
+IndexedList<T, Hash, Equal>::size() const
+{
+    return size_;
+}
+
+template <typename T, typename Hash, typename Equal>
+bool
+IndexedList<T, Hash, Equal>::empty() const
+{
+    return 0 == size_;
+}
+
+template <typename T, typename Hash, typename Equal>
+void
+IndexedList<T, Hash, Equal>::clear()
+{
+    dropIndex();
+    list_.clear();
+}
+
+template <typename T, typename Hash, typename Equal>
+typename IndexedList<T, Hash, Equal>::const_iterator
+IndexedList<T, Hash, Equal>::begin() const
+{
+    return list_.begin();
+}
+
+template <typename T, typename Hash, typename Equal>
+typename IndexedList<T, Hash, Equal>::const_iterator
+IndexedList<T, Hash, Equal>::end() const
+{
+    return list_.end();
+}
+
+template <typename T, typename Hash, typename Equal>
+void
+IndexedList<T, Hash, Equal>::indexNode(Node* node)
+{
+    attach(new Entry(node, hash_(node->data_), NULL));
+}
+
+template <typename T, typename Hash, typename Equal>
+void
+IndexedList<T, Hash, Equal>::unindexNode(Node* node)
+{
+    delete detach(node);
+}
+
+/// Links entry into its bucket by the stored hash.
+template <typename T, typename Hash, typename Equal>
+void
+IndexedList<T, Hash, Equal>::attach(Entry* entry)
+{
+    if (size_ >= buckets_.size()) {
+        rehash(2 * buckets_.size());
+    }
+    Entry*& bucket = buckets_[ListHashing::scatter(entry->hash_) & (buckets_.size() - 1)];
+    entry->next_ = bucket;
+    bucket = entry;
+    ++size_;
+}
+
+/// Unlinks and returns the entry of node; locating it costs one hash.
+template <typename T, typename Hash, typename Equal>
+typename IndexedList<T, Hash, Equal>::Entry*
+IndexedList<T, Hash, Equal>::detach(Node* node)
+{
+    Entry** link = &buckets_[ListHashing::scatter(hash_(node->data_)) & (buckets_.size() - 1)];
+    while ((*link)->node_ != node) {
+        link = &(*link)->next_;
+    }
+    Entry* entry = *link;
+    *link = entry->next_;
+    --size_;
+    return entry;
+}
+
+/// Moves the index entries of rhv's nodes [first, last) into this index.
+/// The entries themselves move, so nothing is allocated and the stored
+/// hashes are reused. Taking all of rhv walks its buckets and hashes
+/// nothing; a partial range hashes each payload once to find its entry.
+template <typename T, typename Hash, typename Equal>
+void
+IndexedList<T, Hash, Equal>::adopt(IndexedList& rhv, Node* first, Node* last)
+{
+    if (first == rhv.list_.begin_ && last == rhv.list_.end_) {
+        size_type bucketCount = buckets_.size();
+        while (size_ + rhv.size_ >= bucketCount) {
+            bucketCount *= 2;
+        }
+        if (bucketCount != buckets_.size()) {
+            rehash(bucketCount);
+        }
+        for (size_type i = 0; i < rhv.buckets_.size(); ++i) {
+            Entry* entry = rhv.buckets_[i];
+            rhv.buckets_[i] = NULL;
+            while (entry != NULL) {
+                Entry* next = entry->next_;
+                attach(entry);
+                entry = next;
+            }
+        }
+        rhv.size_ = 0;
+        return;
+    }
+    for (Node* node = first; node != last; node = node->next_) {
+        attach(rhv.detach(node));
+    }
+}
+
+template <typename T, typename Hash, typename Equal>
+typename IndexedList<T, Hash, Equal>::Entry*
+IndexedList<T, Hash, Equal>::lookup(const_reference value) const
+{
+    const size_t hash = hash_(value);
+    for (Entry* entry = buckets_[ListHashing::scatter(hash) & (buckets_.size() - 1)]; entry != NULL; entry = entry->next_) {
+        if (entry->hash_ == hash && equal_(entry->node_->data_, value)) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+template <typename T, typename Hash, typename Equal>
+void
+IndexedList<T, Hash, Equal>::rehash(const size_type bucketCount)
+{
+    std::vector<Entry*> buckets(bucketCount, static_cast<Entry*>(NULL));
+    for (size_type i = 0; i < buckets_.size(); ++i) {
+        Entry* entry = buckets_[i];
+        while (entry != NULL) {
+            Entry* next = entry->next_;
+            Entry*& bucket = buckets[ListHashing::scatter(entry->hash_) & (bucketCount - 1)];
+            entry->next_ = bucket;
+            bucket = entry;
+            entry = next;
+        }
+    }
+    buckets_.swap(buckets);
+}
+
+template <typename T, typename Hash, typename Equal>
+void
+IndexedList<T, Hash, Equal>::dropIndex()
+{
+    for (size_type i = 0; i < buckets_.size(); ++i) {
+        Entry* entry = buckets_[i];
+        while (entry != NULL) {
+            Entry* next = entry->next_;
+            delete entry;
+            entry = next;
+        }
+        buckets_[i] = NULL;
+    }
+    size_ = 0;
+}
@@ -0,0 +1,357 @@
+#include "../headers/LazyList.hpp"
+#include <cstddef>
+#include <cassert>
+
+///=====================================LAZY_LIST========================================================
+
+template <typename T>
+LazyList<T>::LazyList(const double threshold)
+    : slots_()
+    , live_(0)
+    , dead_(0)
+    , threshold_(threshold)
+{}
+
+template <typename T>
+typename LazyList<T>::iterator
+LazyList<T>::insert(iterator position, const_reference value)
+{
+    ++live_;
+    return iterator(slots_.insert(position.getIt(), Slot(value)));
+}
+
+template <typename T>
+typename LazyList<T>::iterator
+LazyList<T>::erase(iterator position)
+{
+    SlotIterator it = position.getIt();
+    bury(it);
+    iterator next(it);
+    ++next;
+    if (static_cast<double>(dead_) > threshold_ * static_cast<double>(live_ + dead_)) {
+        compact_tombstones();
+    }
+    return next;
+}
+
+template <typename T>
+void
+LazyList<T>::push_back(const_reference value)
+{
+    slots_.push_back(Slot(value));
+    ++live_;
+}
+
+template <typename T>
+void
+LazyList<T>::push_front(const_reference value)
+{
+    slots_.push_front(Slot(value));
+    ++live_;
+}
+
+template <typename T>
+void
+LazyList<T>::pop_back()
+{
+    if (empty()) return;
+    erase(iterator(lastLive()));
+}
+
+template <typename T>
+void
+LazyList<T>::pop_front()
+{
+    if (empty()) return;
+    erase(iterator(firstLive()));
+}
+
+template <typename T>
+typename LazyList<T>::reference
+LazyList<T>::front()
+{
+    return (*firstLive()).value_;
+}
+
+template <typename T>
+typename LazyList<T>::const_reference
+LazyList<T>::front() const
+{
+    return (*firstLive()).value_;
+}
+
+template <typename T>
+typename LazyList<T>::reference
+LazyList<T>::back()
+{
+    return (*lastLive()).value_;
+}
+
+template <typename T>
+typename LazyList<T>::const_reference
+LazyList<T>::back() const
+{
+    return (*lastLive()).value_;
+}
+
+template <typename T>
+void
+LazyList<T>::compact_tombstones()
+{
+    if (0 == dead_) return;
+
+    slots_.remove_if(IsDead());
+    dead_ = 0;
+}
+
+template <typename T>
+typename LazyList<T>::size_type
+LazyList<T>::tombstones() const
+{
+    return dead_;
+}
+
+template <typename T>
+double
+LazyList<T>::compaction_threshold() const
+{
+    return threshold_;
+}
+
+template <typename T>
+void
+LazyList<T>::set_compaction_threshold(const double threshold)
+{
+    threshold_ = threshold;
+}
+
+template <typename T>
+typename LazyList<T>::size_type
+LazyList<T>::size() const
+{
+    return live_;
+}
+
+template <typename T>
+bool
+LazyList<T>::empty() const
+{
+    return 0 == live_;
+}
+
+template <typename T>
+void
+LazyList<T>::clear()
+{
+    slots_.clear();
+    live_ = 0;
+    dead_ = 0;
+}
+
+template <typename T>
+typename LazyList<T>::const_iterator
+LazyList<T>::begin() const
+{
+    return const_iterator(firstLive());
+}
+
+template <typename T>
+typename LazyList<T>::const_iterator
+LazyList<T>::end() const
+{
+    return const_iterator(slots_.end());
+}
+
+template <typename T>
+typename LazyList<T>::iterator
+LazyList<T>::begin()
+{
+    return iterator(firstLive());
+}
+
+template <typename T>
+typename LazyList<T>::iterator
+LazyList<T>::end()
+{
+    return iterator(slots_.end());
+}
+
+/// The end sentinel holds a default Slot, which is live, so skipping
+/// tombstones forward always stops at end() at the latest.
+template <typename T>
+typename LazyList<T>::SlotIterator
+LazyList<T>::firstLive() const
+{
+    SlotIterator it = slots_.begin();
+    while ((*it).dead_) {
+        ++it;
+    }
+    return it;
+}
+
+template <typename T>
+typename LazyList<T>::SlotIterator
+LazyList<T>::lastLive() const
+{
+    assert(!empty());
+    SlotIterator it = slots_.end();
+    do {
+        --it;
+    } while ((*it).dead_);
+    return it;
+}
+
+template <typename T>
+void
+LazyList<T>::bury(SlotIterator position)
+{
+    assert(!(*position).dead_);
+    (*position).dead_ = true;
+    --live_;
+    ++dead_;
+}
+
+///==================================CONST_ITERATOR===============================================================
+template <typename T>
+LazyList<T>::const_iterator::const_iterator()
+    : it_()
+{}
+
+template <typename T>
+LazyList<T>::const_iterator::const_iterator(const const_iterator& rhv)
+    : it_(rhv.it_)
+{}
+
+template <typename T>
+LazyList<T>::const_iterator::const_iterator(SlotIterator it)
+    : it_(it)
+{}
+
+template <typename T>
+LazyList<T>::const_iterator::~const_iterator()
+{}
+
+template <typename T>
+typename LazyList<T>::const_iterator&
+LazyList<T>::const_iterator::operator=(const const_iterator& rhv)
+{
+    if (this != &rhv) {
+        it_ = rhv.it_;
+    }
+    return *this;
+}
+
+template <typename T>
+typename LazyList<T>::const_reference
+LazyList<T>::const_iterator::operator*() const
+{
+    return (*it_).value_;
+}
+
+template <typename T>
+typename LazyList<T>::const_pointer
+LazyList<T>::const_iterator::operator->() const
+{
+    return &(*it_).value_;
+}
+
+template <typename T>
+typename LazyList<T>::const_iterator&
+LazyList<T>::const_iterator::operator++()
+{
+    do {
+        ++it_;
+    } while ((*it_).dead_);
+    return *this;
+}
+
+template <typename T>
+typename LazyList<T>::const_iterator
+LazyList<T>::const_iterator::operator++(int)
+{
+    const_iterator temp(*this);
+    ++(*this);
+    return temp;
+}
+
+template <typename T>
+typename LazyList<T>::const_iterator&
+LazyList<T>::const_iterator::operator--()
+{
+    do {
+        --it_;
+    } while ((*it_).dead_);
+    return *this;
+}
+
+template <typename T>
+typename LazyList<T>::const_iterator
+LazyList<T>::const_iterator::operator--(int)
+{
+    const_iterator temp(*this);
+    --(*this);
+    return temp;
+}
+
+template <typename T>
+bool
+LazyList<T>::const_iterator::operator==(const const_iterator& rhv) const
+{
+    return it_ == rhv.it_;
+}
+
+template <typename T>
+bool
+LazyList<T>::const_iterator::operator!=(const const_iterator& rhv) const
+{
+    return !(*this == rhv);
+}
+
+template <typename T>
+typename LazyList<T>::SlotIterator
+LazyList<T>::const_iterator::getIt() const
+{
+    return it_;
+}
+
+///===================================ITERATOR===============================================================
+template <typename T>
+LazyList<T>::iterator::iterator()
+    : const_iterator()
+{}
+
+template <typename T>
+LazyList<T>::iterator::iterator(const iterator& rhv)
+    : const_iterator(rhv)
+{}
+
+template <typename T>
+LazyList<T>::iterator::iterator(SlotIterator it)
+    : const_iterator(it)
+{}
+
+template <typename T>
+LazyList<T>::iterator::~iterator()
+{}
+
+template <typename T>
+typename LazyList<T>::iterator&
+LazyList<T>::iterator::operator=(const iterator& rhv)
+{
+    const_iterator::operator=(rhv);
+    return *this;
+}
+
+template <typename T>
+typename LazyList<T>::reference
+LazyList<T>::iterator::operator*() const
+{
+    return (*this->getIt()).value_;
+}
+
+template <typename T>
+typename LazyList<T>::pointer
+LazyList<T>::iterator::operator->() const
+{
+    return &(*this->getIt()).value_;
+}
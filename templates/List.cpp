@@ -2,6 +2,9 @@
 #include <cstddef>
 #include <cassert>
 #include <limits>
+#include <functional>
+#include <algorithm>
+#include <vector>
 
 ///=====================================LIST=============================================================
 
@@ -9,12 +12,18 @@ template <typename T>
 List<T>::List()
     : begin_(new Node())
     , end_(begin_)
+    , finger_(NULL)
+    , fingerIndex_(0)
+    , size_(0)
 {}
 
 template <typename T>
 List<T>::List(const size_type size, const_reference value)
     : begin_(new Node())
     , end_(begin_)
+    , finger_(NULL)
+    , fingerIndex_(0)
+    , size_(0)
 {
     resize(size, value);
 }
@@ -23,6 +32,9 @@ template <typename T>
 List<T>::List(const int size, const_reference value)
     : begin_(new Node())
     , end_(begin_)
+    , finger_(NULL)
+    , fingerIndex_(0)
+    , size_(0)
 {
     resize(size, value);
 }
@@ -31,10 +43,11 @@ template <typename T>
 List<T>::List(const List<T>& rhv)
     : begin_(new Node())
     , end_(begin_)
+    , finger_(NULL)
+    , fingerIndex_(0)
+    , size_(0)
 {
-    for (const_iterator it = rhv.begin(); it != rhv.end(); ++it) {
-        push_back(*it);
-    }
+    append(rhv.begin(), rhv.end());
 }
 
 template <typename T>
@@ -42,16 +55,18 @@ template <typename InputIterator>
 List<T>::List(InputIterator first, InputIterator last)
     : begin_(new Node())
     , end_(begin_)
+    , finger_(NULL)
+    , fingerIndex_(0)
+    , size_(0)
 {
-    for (InputIterator it = first; it != last; ++it) {
-        push_back(*it);
-    }
+    append(first, last);
 }
 
 template <typename T>
 List<T>::~List()
 {
     clear();
+    delete end_;
 }
 
 template <typename T>
@@ -59,9 +74,16 @@ List<T>&
 List<T>::operator=(const List<T>& rhv)
 {
     if (this != &rhv) {
-        clear();
-        for (const_iterator it = rhv.begin(); it != rhv.end(); ++it) {
-            push_back(*it); 
+        /// reuse the nodes we already have, allocate or free only the difference
+        Node* node = begin_;
+        const Node* source = rhv.begin_;
+        for ( ; node != end_ && source != rhv.end_; node = node->next_, source = source->next_) {
+            node->data_ = source->data_;
+        }
+        if (source != rhv.end_) {
+            append(const_iterator(const_cast<Node*>(source)), rhv.end());
+        } else {
+            destroy(unlink(node, end_, size_ - rhv.size_));
         }
     }
     return *this;
@@ -71,13 +93,12 @@ template <typename T>
 bool
 List<T>::operator==(const List<T>& rhv) const
 {
-    if (this == &rhv)         return true;
-    if (size() != rhv.size()) return false;
-
-    for (const_iterator it1 = begin(), it2 = rhv.begin();
-        it1 != end() && it2 != rhv.end(); ++it1, ++it2) {
+    if (this == &rhv) return true;
+    if (size_ != rhv.size_) return false;
 
-        if (*it1 != *it2) {
+    const Node* node2 = rhv.begin_;
+    for (const Node* node1 = begin_; node1 != end_; node1 = node1->next_, node2 = node2->next_) {
+        if (node1->data_ != node2->data_) {
             return false;
         }
     }
@@ -95,44 +116,56 @@ template <typename T>
 bool
 List<T>::operator<(const List<T>& rhv) const
 {
-    return lexicographical_compare(begin(), end(), rhv.begin(), rhv.end());
+    return compare(rhv) < 0;
 }
 
 template <typename T>
 bool
 List<T>::operator>(const List<T>& rhv) const
 {
-    return !(*this == rhv || *this < rhv);
+    return compare(rhv) > 0;
 }
 
 template <typename T>
 bool
 List<T>::operator<=(const List<T>& rhv) const
 {
-    return !(*this > rhv);
+    return compare(rhv) <= 0;
 }
 
 template <typename T>
 bool
 List<T>::operator>=(const List<T>& rhv) const
 {
-    return !(*this < rhv);
+    return compare(rhv) >= 0;
 }
 
 template <typename T>
-typename List<T>::iterator
-List<T>::insert(iterator position, const_reference value)
+int
+List<T>::compare(const List<T>& rhv) const
 {
-    Node* newNode = new Node(value, position->previous_, position.getPtr());
+    if (this == &rhv) return 0;
 
-    position->previous_ = newNode;
-
-    if (newNode->previous_ != NULL) {
-        newNode->previous_->next_ = newNode; 
-    } else {
-        begin_ = newNode;
+    ListCompare<T> threeWay;
+    const Node* node1 = begin_;
+    const Node* node2 = rhv.begin_;
+    for ( ; node1 != end_ && node2 != rhv.end_; node1 = node1->next_, node2 = node2->next_) {
+        const int result = threeWay(node1->data_, node2->data_);
+        if (result != 0) {
+            return result < 0 ? -1 : 1;
+        }
     }
+    if (node1 != end_) return 1;
+    if (node2 != rhv.end_) return -1;
+    return 0;
+}
 
+template <typename T>
+typename List<T>::iterator
+List<T>::insert(iterator position, const_reference value)
+{
+    Node* newNode = new Node(value);
+    link(newNode, position.getPtr());
     return iterator(newNode);
 }
 
@@ -172,16 +205,7 @@ List<T>::erase(iterator position)
 {
     Node* ptr = position.getPtr();
     Node* nextNode = ptr->next_;
-
-    ptr->next_->previous_ = ptr->previous_;
-
-    if (ptr->previous_) {
-        ptr->previous_->next_ = ptr->next_;
-    } else {
-        begin_ = ptr->next_;
-    }
-
-    delete ptr;
+    destroy(unlink(ptr, nextNode, 1));
     return iterator(nextNode);
 }
 
@@ -190,33 +214,41 @@ template <typename T>
 typename List<T>::iterator
 List<T>::erase(iterator first, iterator last)
 {
-    while (first != last) {
-        first = erase(first);
-    }
+    destroy(unlink(first.getPtr(), last.getPtr(), distance(first.getPtr(), last.getPtr())));
     return last;
 }
 
+template <typename T>
+typename List<T>::node_handle
+List<T>::extract(iterator position)
+{
+    Node* node = position.getPtr();
+    return node_handle(unlink(node, node->next_, 1));
+}
+
+template <typename T>
+typename List<T>::iterator
+List<T>::insert(iterator position, node_handle node)
+{
+    if (node.empty()) return position;
+
+    Node* ptr = node.release();
+    link(ptr, position.getPtr());
+    return iterator(ptr);
+}
+
 template <typename T>
 void
 List<T>::push_back(const_reference value)
 { 
-    if (empty()) {
-        push_front(value);
-        return;
-    }
-
-    Node* newNode = new Node(value, end_->previous_, end_);
-    end_->previous_->next_ = newNode;
-    end_->previous_ = newNode;
+    link(new Node(value), end_);
 }
 
 template <typename T>
 void
 List<T>::push_front(const_reference value)
 {
-    Node* newNode = new Node(value, NULL, begin_);
-    begin_->previous_ = newNode;
-    begin_ = newNode;
+    link(new Node(value), begin_);
 }
 
 template <typename T>
@@ -224,16 +256,8 @@ void
 List<T>::pop_back()
 {
     if (empty()) return;
-    
-    Node* ptr = end_->previous_;
-    end_->previous_ = end_->previous_->previous_;
-   
-    if (NULL != end_->previous_) {
-        end_->previous_->next_ = end_;
-    } else {
-        begin_ = end_;
-    }
-    delete ptr;
+
+    destroy(unlink(end_->previous_, end_, 1));
 }
 
 template <typename T>
@@ -241,12 +265,8 @@ void
 List<T>::pop_front()
 {
     if (empty()) return;
-    
-    Node* ptr = begin_;
-    
-    begin_ = begin_->next_;
-    begin_->previous_ = NULL;
-    delete ptr;   
+
+    destroy(unlink(begin_, begin_->next_, 1));
 }
 
 template <typename T>
@@ -281,35 +301,24 @@ template <typename T>
 void
 List<T>::swap(List<T>& rhv)
 {
-    List<T> temp(*this);
-    *this = rhv;
-    rhv = temp;
+    std::swap(begin_, rhv.begin_);
+    std::swap(end_, rhv.end_);
+    std::swap(finger_, rhv.finger_);
+    std::swap(fingerIndex_, rhv.fingerIndex_);
+    std::swap(size_, rhv.size_);
 }
 
 template <typename T>
 void
 List<T>::splice(iterator position, List<T>& rhv) 
 {
-    if (empty()) {
-        begin_ = rhv.begin_;
-        end_   = rhv.end_;
-    } else {
-        Node* posNode = position.getPtr();
-
-        Node* firstRhv = rhv.begin_;
-        Node* lastRhv  = rhv.end_->previous_;
+    if (&rhv == this || rhv.empty()) return;
 
-        lastRhv->next_ = posNode;
-        if (posNode->previous_ != NULL) {
-            posNode->previous_->next_ = firstRhv;
-        } else {
-            begin_ = firstRhv; 
-        }
-        firstRhv->previous_ = posNode->previous_;
-        posNode->previous_ = lastRhv;
-    }
-    rhv.begin_ = rhv.end_;
-    rhv.end_->previous_ = NULL;
+    const size_type count = rhv.size_;
+    Node* first = rhv.begin_;
+    Node* last  = rhv.end_->previous_;
+    rhv.unlink(first, rhv.end_, count);
+    link(first, last, position.getPtr(), count);
 }
 
 template <typename T>
@@ -322,31 +331,12 @@ List<T>::splice(iterator position, List<T>& rhv, iterator index)
     if (NULL == nodeIndex || NULL == posNode || nodeIndex == posNode || nodeIndex->next_ == posNode) {
         return;
     }
-
-    if (nodeIndex->previous_ != NULL) {
-        nodeIndex->previous_->next_ = nodeIndex->next_;
-    } else {
-        rhv.begin_ = nodeIndex->next_; 
-    }
-
-    if (nodeIndex->next_ != NULL) {
-        nodeIndex->next_->previous_ = nodeIndex->previous_;
-    } else {
-        rhv.end_->previous_ = nodeIndex->previous_;
-    }
-    /// insert
-    nodeIndex->next_ = posNode;
-    nodeIndex->previous_ = posNode->previous_;
-
-    if (posNode->previous_ != NULL) {
-        posNode->previous_->next_ = nodeIndex;
-    } else {
-        begin_ = nodeIndex;
-    }
-    
-    posNode->previous_ = nodeIndex;
+    rhv.unlink(nodeIndex, nodeIndex->next_, 1);
+    link(nodeIndex, posNode);
 }
 
+/// Counts the range when it changes lists. Within one list the size stays
+/// the same, and the finger is dropped instead of counting.
 template <typename T>
 void List<T>::splice(iterator position, List<T>& rhv, iterator first, iterator last)
 {
@@ -357,110 +347,132 @@ void List<T>::splice(iterator position, List<T>& rhv, iterator first, iterator l
     if (firstNode == lastNode) {
         return;
     }
-
-    Node* beforeFirst = firstNode->previous_;
-    Node* lastPrev    = (lastNode != NULL ? lastNode->previous_ : rhv.end_->previous_);
-
-    if (beforeFirst != NULL) {
-        beforeFirst->next_ = lastNode;
-    } else {
-        rhv.begin_ = lastNode;
-    }
-
-    if (lastNode != NULL) {
-        lastNode->previous_ = beforeFirst;
-    } else {
-        rhv.end_->previous_ = beforeFirst;
-    }
-
-    ///insert
-    Node* beforePos = posNode->previous_;
-
-    if (beforePos != NULL) {
-        beforePos->next_ = firstNode;
+    size_type count = 0;
+    if (&rhv == this) {
+        resetFinger();
     } else {
-        begin_ = firstNode; 
-    }
-
-    firstNode->previous_ = beforePos;
-
-    if (posNode != NULL) {
-        posNode->previous_ = lastPrev;
-    }
-
-    if (lastPrev != NULL) {
-        lastPrev->next_ = posNode;
+        count = distance(firstNode, lastNode);
     }
+    Node* tail = lastNode->previous_;
+    rhv.unlink(firstNode, lastNode, count);
+    link(firstNode, tail, posNode, count);
 }
 
 template <typename T>
-void
+typename List<T>::size_type
 List<T>::remove(const_reference value)
 {
-    iterator it = begin();
-    while (it != end()) {
-        if (value == *it) {
-            it = erase(it);
-            continue;
-        }
-        ++it;
-    }
+    /// runs are freed only at the end, value may refer to an element of *this
+    return remove_if(EqualTo(value));
 }
 
 template <typename T>
 template <typename Predicate>
-void
+typename List<T>::size_type
 List<T>::remove_if(Predicate predicate)
 {
-    iterator it = begin();
-    while (it != end()) {
-        if (predicate(*it)) {
-            it = erase(it);
+    Node* discarded = NULL;
+    size_type removed = 0;
+
+    Node* node = begin_;
+    while (node != end_) {
+        if (!predicate(node->data_)) {
+            node = node->next_;
             continue;
         }
-        ++it;
+        Node* runEnd = node->next_;
+        size_type run = 1;
+        while (runEnd != end_ && predicate(runEnd->data_)) {
+            runEnd = runEnd->next_;
+            ++run;
+        }
+        discard(node, runEnd, run, discarded);
+        removed += run;
+        node = runEnd;
     }
+
+    destroy(discarded);
+    return removed;
 }
 
 template <typename T>
-void 
+typename List<T>::size_type
 List<T>::unique()
 {
-    if (empty()) return;
+    return unique(std::equal_to<T>());
+}
 
-    iterator current = begin();
-    iterator next = current;
-    ++next;
+template <typename T>
+template <typename BinaryPredicate>
+typename List<T>::size_type
+List<T>::unique(BinaryPredicate predicate)
+{
+    Node* discarded = NULL;
+    size_type removed = 0;
 
-    while (next != end()) {
-        if (*current == *next) {
-            next = erase(next);
-            continue;
+    Node* kept = begin_;
+    while (kept != end_) {
+        Node* runEnd = kept->next_;
+        size_type run = 0;
+        while (runEnd != end_ && predicate(kept->data_, runEnd->data_)) {
+            runEnd = runEnd->next_;
+            ++run;
         }
-        ++current;
-        ++next;
+        if (run != 0) {
+            discard(kept->next_, runEnd, run, discarded);
+            removed += run;
+        }
+        kept = runEnd;
     }
+
+    destroy(discarded);
+    return removed;
 }
 
 template <typename T>
-template <typename BinaryPredicate>
-void 
-List<T>::unique(BinaryPredicate predicate)
+typename List<T>::size_type
+List<T>::dedupe()
 {
-    if (empty()) return;
+    return dedupe(ListHash<T>(), std::equal_to<T>());
+}
 
-    iterator current = begin();
-    iterator next = current;
-    ++next;
+template <typename T>
+template <typename Hash, typename BinaryPredicate>
+typename List<T>::size_type
+List<T>::dedupe(Hash hash, BinaryPredicate equal)
+{
+    const size_type length = size();
+    if (length < 2) return 0;
 
-    while (next != end()) {
-        if (predicate(*current, *next)) {
-            next = erase(next);
-            continue;
-        } 
-        ++current;
-        ++next;
+    /// open addressing with linear probing, load factor kept below 1/2
+    size_type capacity = 4;
+    while (capacity < 2 * length) {
+        capacity <<= 1;
     }
+    const size_type mask = capacity - 1;
+    std::vector<Node*> seen(capacity, static_cast<Node*>(NULL));
+
+    Node* discarded = NULL;
+    size_type removed = 0;
+    Node* node = begin_;
+    while (node != end_) {
+        Node* next = node->next_;
+        size_type slot = ListHashing::scatter(hash(node->data_)) & mask;
+        while (seen[slot] != NULL && !equal(seen[slot]->data_, node->data_)) {
+            slot = (slot + 1) & mask;
+        }
+        if (NULL == seen[slot]) {
+            seen[slot] = node;
+        } else {
+            unlink(node, next, 1)->next_ = discarded;
+            discarded = node;
+            ++removed;
+        }
+        node = next;
+    }
+
+    destroy(discarded);
+    return removed;
 }
 
 template <typename T>
@@ -519,6 +531,12 @@ template <typename T>
 void
 List<T>::reverse()
 {
+    if (empty()) return;
+
+    /// the finger keeps its node, counted from the other end now
+    if (finger_ != NULL && finger_ != end_) {
+        fingerIndex_ = size_ - 1 - fingerIndex_;
+    }
     Node* current = begin_;
     Node* previous = end_; 
     Node* next = NULL;
@@ -527,7 +545,7 @@ List<T>::reverse()
 
         next = current->next_;
         current->next_ = previous;
-        current->previous_ = next;
+        current->previous_ = (next != end_ ? next : NULL);
 
         previous = current;
         current = next;
@@ -541,161 +559,815 @@ template <typename T>
 void
 List<T>::sort()
 {
-    for (iterator it = begin(); it != end(); ++it) {
-        iterator jt = it;
-        ++jt;
-        while (jt != end()) {
-            if (*jt < *it) {
-                std::swap(*it, *jt);
-            }
-            ++jt;
-        }
-    }
+    sort(std::less<T>());
 }
 
+/// Bottom-up merge sort by relinking: stable, O(n log n), nodes keep their
+/// payloads. Bucket i holds a sorted run of 2^i nodes as a NULL-terminated
+/// next_ chain, older runs in higher buckets; previous_ is rebuilt once.
 template <typename T>
 template<typename BinaryPredicate>
 void 
 List<T>::sort(BinaryPredicate comparison)
 {
-    for (iterator it = begin(); it != end(); ++it) {
-        iterator jt = it;
-        ++jt;
-        while (jt != end()) {
-            if (comparison(*jt, *it)) {
-                std::swap(*it, *jt);
-            }
-            ++jt;
+    if (begin_ == end_ || begin_->next_ == end_) return;
+
+    Node* buckets[64];
+    std::fill(buckets, buckets + 64, static_cast<Node*>(NULL));
+    size_type filled = 0;
+
+    end_->previous_->next_ = NULL;
+    Node* node = begin_;
+    while (node != NULL) {
+        Node* carry = node;
+        node = node->next_;
+        carry->next_ = NULL;
+
+        size_type i = 0;
+        for ( ; i < filled && buckets[i] != NULL; ++i) {
+            carry = mergeChains(buckets[i], carry, comparison);
+            buckets[i] = NULL;
+        }
+        buckets[i] = carry;
+        if (i == filled) {
+            ++filled;
         }
     }
+
+    Node* sorted = NULL;
+    for (size_type i = 0; i < filled; ++i) {
+        if (buckets[i] != NULL) {
+            sorted = (NULL == sorted ? buckets[i] : mergeChains(buckets[i], sorted, comparison));
+        }
+    }
+
+    resetFinger();
+    begin_ = sorted;
+    sorted->previous_ = NULL;
+    for ( ; sorted->next_ != NULL; sorted = sorted->next_) {
+        sorted->next_->previous_ = sorted;
+    }
+    sorted->next_ = end_;
+    end_->previous_ = sorted;
 }
 
 template <typename T>
 void
-List<T>::resize(size_type newSize, const_reference value)
+List<T>::partial_sort(const size_type count)
 {
-    const size_type previousSize = size();
-    for (size_type i = previousSize; i < newSize; ++i) {
-        push_back(value);
+    partial_sort(count, std::less<T>());
+}
+
+template <typename T>
+template <typename Compare>
+void
+List<T>::partial_sort(const size_type count, Compare comparison)
+{
+    if (0 == count || empty()) return;
+
+    NodeCompare<Compare> nodeComparison(comparison);
+    std::vector<Node*> heap;
+
+    for (Node* node = begin_; node != end_; node = node->next_) {
+        if (heap.size() < count) {
+            heap.push_back(node);
+            std::push_heap(heap.begin(), heap.end(), nodeComparison);
+        } else if (nodeComparison(node, heap.front())) {
+            std::pop_heap(heap.begin(), heap.end(), nodeComparison);
+            heap.back() = node;
+            std::push_heap(heap.begin(), heap.end(), nodeComparison);
+        }
     }
-    for (size_type i = newSize; i < previousSize; ++i) {
-        pop_back();
+    std::sort_heap(heap.begin(), heap.end(), nodeComparison);
+
+    /// relink the selected nodes in front, the rest keep their relative order
+    Node* position = begin_;
+    for (typename std::vector<Node*>::size_type i = 0; i < heap.size(); ++i) {
+        if (heap[i] == position) {
+            position = position->next_;
+            continue;
+        }
+        splice(iterator(position), *this, iterator(heap[i]));
     }
 }
 
 template <typename T>
-typename List<T>::size_type
-List<T>::size() const
+void
+List<T>::nth_element(const size_type index)
 {
-    const_iterator it = begin();
-    size_type count = 0;
-    while (it != end()) {
-        ++it;
-        ++count;
+    nth_element(index, std::less<T>());
+}
+
+/// Quickselect by relinking: each round splits the current range into
+/// less, equal and greater chains around a median-of-three pivot and
+/// relinks them in place. Expected O(n); inputs built to defeat the
+/// median of three can still take O(n^2).
+template <typename T>
+template <typename Compare>
+void
+List<T>::nth_element(size_type index, Compare comparison)
+{
+    size_type length = size_;
+    if (index >= length) return;
+
+    resetFinger();
+    Node* first = begin_;
+    Node* last = end_;
+    while (length > 1) {
+        Node* middle = first;
+        for (size_type i = 0; i < length / 2; ++i) {
+            middle = middle->next_;
+        }
+        const Node* pivot = medianOfThree(first, middle, last->previous_, comparison);
+
+        Node* before = first->previous_;
+        Node* lessFirst = NULL;
+        Node* lessLast = NULL;
+        Node* equalFirst = NULL;
+        Node* equalLast = NULL;
+        Node* greaterFirst = NULL;
+        Node* greaterLast = NULL;
+        size_type lessCount = 0;
+        size_type greaterCount = 0;
+        for (Node* node = first; node != last; ) {
+            Node* next = node->next_;
+            if (comparison(node->data_, pivot->data_)) {
+                join(lessFirst, lessLast, node, node);
+                ++lessCount;
+            } else if (comparison(pivot->data_, node->data_)) {
+                join(greaterFirst, greaterLast, node, node);
+                ++greaterCount;
+            } else {
+                join(equalFirst, equalLast, node, node);
+            }
+            node = next;
+        }
+
+        Node* rangeFirst = NULL;
+        Node* rangeLast = NULL;
+        join(rangeFirst, rangeLast, lessFirst, lessLast);
+        join(rangeFirst, rangeLast, equalFirst, equalLast);
+        join(rangeFirst, rangeLast, greaterFirst, greaterLast);
+        rangeFirst->previous_ = before;
+        if (before != NULL) {
+            before->next_ = rangeFirst;
+        } else {
+            begin_ = rangeFirst;
+        }
+        rangeLast->next_ = last;
+        last->previous_ = rangeLast;
+
+        const size_type equalCount = length - lessCount - greaterCount;
+        if (index < lessCount) {
+            first = lessFirst;
+            last = equalFirst;
+            length = lessCount;
+        } else if (index < lessCount + equalCount) {
+            break;
+        } else {
+            index -= lessCount + equalCount;
+            first = greaterFirst;
+            length = greaterCount;
+        }
     }
-    return count;
 }
 
 template <typename T>
-typename List<T>::size_type
-List<T>::max_size() const
+template <typename Predicate>
+typename List<T>::iterator
+List<T>::partition(Predicate predicate)
 {
-    return std::numeric_limits<size_type>::max() / sizeof(Node); 
+    /// relinking keeps the relative order for free
+    return stable_partition(predicate);
 }
 
+/// One pass: rejected nodes are unlinked into a chain that goes to the back.
 template <typename T>
-bool
-List<T>::empty() const
-{
-    return end_ == begin_;
+template <typename Predicate>
+typename List<T>::iterator
+List<T>::stable_partition(Predicate predicate)
+{
+    Node* rejectedFirst = NULL;
+    Node* rejectedLast = NULL;
+    size_type rejected = 0;
+
+    Node* node = begin_;
+    while (node != end_) {
+        Node* next = node->next_;
+        if (!predicate(node->data_)) {
+            unlink(node, next, 1);
+            join(rejectedFirst, rejectedLast, node, node);
+            ++rejected;
+        }
+        node = next;
+    }
+
+    if (NULL == rejectedFirst) return end();
+
+    link(rejectedFirst, rejectedLast, end_, rejected);
+    return iterator(rejectedFirst);
 }
 
 template <typename T>
 void
-List<T>::clear()
+List<T>::set_union_splice(List<T>& rhv)
 {
-    while (!empty()) {
-        pop_back();
-    }
+    set_union_splice(rhv, std::less<T>());
 }
 
 template <typename T>
-typename List<T>::const_iterator
-List<T>::begin() const
+template <typename Compare>
+void
+List<T>::set_union_splice(List<T>& rhv, Compare comparison)
 {
-    return const_iterator(begin_); 
+    if (&rhv == this) return;
+
+    Node* discarded = NULL;
+    iterator itThis = begin();
+    iterator itRhv  = rhv.begin();
+
+    while (itThis != end() && itRhv != rhv.end()) {
+        if (comparison(*itRhv, *itThis)) {
+            iterator nextRhv = itRhv;
+            ++nextRhv;
+            splice(itThis, rhv, itRhv);
+            itRhv = nextRhv;
+            continue;
+        }
+        if (!comparison(*itThis, *itRhv)) {
+            /// equal keys: keep ours, drop the duplicate from rhv
+            Node* duplicate = itRhv.getPtr();
+            ++itRhv;
+            rhv.unlink(duplicate, duplicate->next_, 1)->next_ = discarded;
+            discarded = duplicate;
+        }
+        ++itThis;
+    }
+
+    if (itRhv != rhv.end()) {
+        splice(end(), rhv, itRhv, rhv.end());
+    }
+    destroy(discarded);
 }
 
 template <typename T>
-typename List<T>::const_iterator
-List<T>::end() const
+void
+List<T>::set_intersection_splice(const List<T>& rhv)
 {
-    return const_iterator(end_); 
+    set_intersection_splice(rhv, std::less<T>());
 }
 
 template <typename T>
-typename List<T>::const_reverse_iterator
-List<T>::rbegin() const
+template <typename Compare>
+void
+List<T>::set_intersection_splice(const List<T>& rhv, Compare comparison)
 {
-    return const_reverse_iterator(end_->previous_); 
+    if (&rhv == this) return;
+
+    Node* discarded = NULL;
+    iterator itThis = begin();
+    const_iterator itRhv = rhv.begin();
+
+    while (itThis != end() && itRhv != rhv.end()) {
+        if (comparison(*itThis, *itRhv)) {
+            Node* missing = itThis.getPtr();
+            ++itThis;
+            unlink(missing, missing->next_, 1)->next_ = discarded;
+            discarded = missing;
+            continue;
+        }
+        if (!comparison(*itRhv, *itThis)) {
+            ++itThis;
+        }
+        ++itRhv;
+    }
+
+    destroy(discarded);
+    destroy(unlink(itThis.getPtr(), end_, distance(itThis.getPtr(), end_)));
 }
 
 template <typename T>
-typename List<T>::const_reverse_iterator
-List<T>::rend() const
+void
+List<T>::set_difference_splice(const List<T>& rhv)
 {
-    return const_reverse_iterator(begin_->previous_); 
+    set_difference_splice(rhv, std::less<T>());
 }
 
 template <typename T>
-typename List<T>::iterator
-List<T>::begin()
+template <typename Compare>
+void
+List<T>::set_difference_splice(const List<T>& rhv, Compare comparison)
 {
-    return iterator(begin_); 
+    if (&rhv == this) {
+        clear();
+        return;
+    }
+
+    Node* discarded = NULL;
+    iterator itThis = begin();
+    const_iterator itRhv = rhv.begin();
+
+    while (itThis != end() && itRhv != rhv.end()) {
+        if (comparison(*itThis, *itRhv)) {
+            ++itThis;
+            continue;
+        }
+        if (!comparison(*itRhv, *itThis)) {
+            Node* common = itThis.getPtr();
+            ++itThis;
+            unlink(common, common->next_, 1)->next_ = discarded;
+            discarded = common;
+        }
+        ++itRhv;
+    }
+
+    destroy(discarded);
 }
 
 template <typename T>
-typename List<T>::iterator
-List<T>::end()
+template <typename Function>
+Function
+List<T>::for_each(Function function, const size_type distance)
 {
-    return iterator(end_); 
+    for (const_prefetch_iterator it = prefetch_begin(distance); it.ptr_ != end_; ++it) {
+        function(it.ptr_->data_);
+    }
+    return function;
 }
 
 template <typename T>
-typename List<T>::reverse_iterator
-List<T>::rbegin()
+template <typename Function>
+Function
+List<T>::for_each(Function function, const size_type distance) const
 {
-    return reverse_iterator(end_->previous_); 
+    for (const_prefetch_iterator it = prefetch_begin(distance); it.ptr_ != end_; ++it) {
+        function(*it);
+    }
+    return function;
 }
 
 template <typename T>
-typename List<T>::reverse_iterator
-List<T>::rend()
+typename List<T>::value_type
+List<T>::accumulate(value_type init) const
 {
-    return reverse_iterator(begin_->previous_); 
+    return accumulate(init, std::plus<T>());
 }
 
 template <typename T>
-template <typename InputIt1, typename InputIt2>
-bool
-List<T>::lexicographical_compare(InputIt1 first1, InputIt1 last1,
-                                 InputIt2 first2, InputIt2 last2)
+template <typename BinaryOperation>
+typename List<T>::value_type
+List<T>::accumulate(value_type init, BinaryOperation operation) const
 {
-    for ( ; (first1 != last1) && (first2 != last2); ++first1, ++first2) {
-        if (*first1 < *first2) return true; 
-        if (*first2 < *first1) return false; 
+    for (const_prefetch_iterator it = prefetch_begin(); it.ptr_ != end_; ++it) {
+        init = operation(init, *it);
     }
-    return (first1 == last1) && (first2 != last2);
+    return init;
 }
 
-///==================================CONST_ITERATOR===============================================================
 template <typename T>
-List<T>::const_iterator::const_iterator()
-    : ptr_(NULL)
-{}
+template <typename Predicate>
+typename List<T>::iterator
+List<T>::find_if(Predicate predicate)
+{
+    const_prefetch_iterator it = prefetch_begin();
+    while (it.ptr_ != end_ && !predicate(it.ptr_->data_)) {
+        ++it;
+    }
+    return iterator(it.ptr_);
+}
 
 template <typename T>
-List<T>::const_iterator::const_iterator(const const_iterator& rhv)
+template <typename Predicate>
+typename List<T>::const_iterator
+List<T>::find_if(Predicate predicate) const
+{
+    const_prefetch_iterator it = prefetch_begin();
+    while (it.ptr_ != end_ && !predicate(*it)) {
+        ++it;
+    }
+    return it.base();
+}
+
+template <typename T>
+void
+List<T>::resize(size_type newSize, const_reference value)
+{
+    const size_type previousSize = size();
+    if (newSize > previousSize) {
+        append(newSize - previousSize, value);
+    } else if (newSize < previousSize) {
+        destroy(unlink(nodeAt(newSize), end_, previousSize - newSize));
+    }
+}
+
+template <typename T>
+typename List<T>::size_type
+List<T>::size() const
+{
+    return size_;
+}
+
+template <typename T>
+typename List<T>::reference
+List<T>::at(const size_type index)
+{
+    assert(index < size_);
+    return moveFinger(index)->data_;
+}
+
+template <typename T>
+typename List<T>::const_reference
+List<T>::at(const size_type index) const
+{
+    assert(index < size_);
+    return nodeAt(index)->data_;
+}
+
+template <typename T>
+typename List<T>::iterator
+List<T>::seek(const size_type index)
+{
+    return iterator(moveFinger(index));
+}
+
+template <typename T>
+typename List<T>::const_iterator
+List<T>::seek(const size_type index) const
+{
+    return const_iterator(nodeAt(index));
+}
+
+template <typename T>
+typename List<T>::size_type
+List<T>::max_size() const
+{
+    return std::numeric_limits<size_type>::max() / sizeof(Node); 
+}
+
+template <typename T>
+bool
+List<T>::empty() const
+{
+    return end_ == begin_;
+}
+
+template <typename T>
+void
+List<T>::clear()
+{
+    destroy(unlink(begin_, end_, size_));
+}
+
+template <typename T>
+typename List<T>::const_iterator
+List<T>::begin() const
+{
+    return const_iterator(begin_); 
+}
+
+template <typename T>
+typename List<T>::const_iterator
+List<T>::end() const
+{
+    return const_iterator(end_); 
+}
+
+template <typename T>
+typename List<T>::const_reverse_iterator
+List<T>::rbegin() const
+{
+    return const_reverse_iterator(end_->previous_); 
+}
+
+template <typename T>
+typename List<T>::const_reverse_iterator
+List<T>::rend() const
+{
+    return const_reverse_iterator(begin_->previous_); 
+}
+
+template <typename T>
+typename List<T>::iterator
+List<T>::begin()
+{
+    return iterator(begin_); 
+}
+
+template <typename T>
+typename List<T>::iterator
+List<T>::end()
+{
+    return iterator(end_); 
+}
+
+template <typename T>
+typename List<T>::reverse_iterator
+List<T>::rbegin()
+{
+    return reverse_iterator(end_->previous_); 
+}
+
+template <typename T>
+typename List<T>::reverse_iterator
+List<T>::rend()
+{
+    return reverse_iterator(begin_->previous_); 
+}
+
+template <typename T>
+typename List<T>::const_prefetch_iterator
+List<T>::prefetch_begin(const size_type distance) const
+{
+    return const_prefetch_iterator(begin_, distance);
+}
+
+template <typename T>
+typename List<T>::const_prefetch_iterator
+List<T>::prefetch_end() const
+{
+    return const_prefetch_iterator(end_, 0);
+}
+
+/// Walks from whichever of begin_, end_ or the finger is nearest. Reads
+/// the finger only, so const callers may share the list between threads.
+template <typename T>
+typename List<T>::Node*
+List<T>::nodeAt(const size_type index) const
+{
+    const size_type length = size_;
+    assert(index <= length);
+
+    Node* node = begin_;
+    size_type current = 0;
+    size_type steps = index;
+
+    if (length - index < steps) {
+        node = end_;
+        current = length;
+        steps = length - index;
+    }
+    if (finger_ != NULL) {
+        const size_type fromFinger = (index < fingerIndex_ ? fingerIndex_ - index : index - fingerIndex_);
+        if (fromFinger < steps) {
+            node = finger_;
+            current = fingerIndex_;
+        }
+    }
+
+    for ( ; current < index; ++current) {
+        node = node->next_;
+    }
+    for ( ; current > index; --current) {
+        node = node->previous_;
+    }
+    return node;
+}
+
+template <typename T>
+typename List<T>::Node*
+List<T>::moveFinger(const size_type index)
+{
+    finger_ = nodeAt(index);
+    fingerIndex_ = index;
+    return finger_;
+}
+
+template <typename T>
+void
+List<T>::resetFinger()
+{
+    finger_ = NULL;
+    fingerIndex_ = 0;
+}
+
+/// Appends in one tight loop, with no per-element empty() check or
+/// finger bookkeeping. Every node is still its own allocation: nodes are
+/// freed and spliced one at a time, so a run cannot share a block, and a
+/// trivially copyable T already copies as a plain store.
+template <typename T>
+template <typename InputIterator>
+void
+List<T>::append(InputIterator first, InputIterator last)
+{
+    size_type count = 0;
+    for ( ; first != last; ++first, ++count) {
+        Node* node = new Node(*first, end_->previous_, end_);
+        if (node->previous_ != NULL) {
+            node->previous_->next_ = node;
+        } else {
+            begin_ = node;
+        }
+        end_->previous_ = node;
+    }
+
+    if (finger_ == end_) {
+        fingerIndex_ += count;
+    }
+    size_ += count;
+}
+
+template <typename T>
+void
+List<T>::append(size_type count, const_reference value)
+{
+    for (size_type i = 0; i < count; ++i) {
+        Node* node = new Node(value, end_->previous_, end_);
+        if (node->previous_ != NULL) {
+            node->previous_->next_ = node;
+        } else {
+            begin_ = node;
+        }
+        end_->previous_ = node;
+    }
+
+    if (finger_ == end_) {
+        fingerIndex_ += count;
+    }
+    size_ += count;
+}
+
+template <typename T>
+void
+List<T>::link(Node* node, Node* position)
+{
+    link(node, node, position, 1);
+}
+
+/// Links the count nodes first..last, whose inner previous_/next_ are
+/// already set. The finger keeps its node; its index moves when the chain
+/// lands before it, and it is dropped when that cannot be told in O(1).
+template <typename T>
+void
+List<T>::link(Node* first, Node* last, Node* position, const size_type count)
+{
+    if (finger_ != NULL) {
+        if (position == finger_ || position == begin_) {
+            fingerIndex_ += count;
+        } else if (position != end_) {
+            resetFinger();
+        }
+    }
+    size_ += count;
+
+    last->next_ = position;
+    first->previous_ = position->previous_;
+
+    if (position->previous_ != NULL) {
+        position->previous_->next_ = first;
+    } else {
+        begin_ = first;
+    }
+    position->previous_ = last;
+}
+
+/// Detaches the count nodes [first, last) as a NULL-terminated chain.
+template <typename T>
+typename List<T>::Node*
+List<T>::unlink(Node* first, Node* last, const size_type count)
+{
+    if (first == last) return NULL;
+
+    if (finger_ != NULL) {
+        if (first == begin_) {
+            if (fingerIndex_ < count) {
+                resetFinger();
+            } else {
+                fingerIndex_ -= count;
+            }
+        } else if (last == finger_) {
+            fingerIndex_ -= count;
+        } else if (last != end_ || fingerIndex_ >= size_ - count) {
+            resetFinger();
+        }
+    }
+    size_ -= count;
+
+    Node* tail = last->previous_;
+
+    last->previous_ = first->previous_;
+    if (first->previous_ != NULL) {
+        first->previous_->next_ = last;
+    } else {
+        begin_ = last;
+    }
+
+    first->previous_ = NULL;
+    tail->next_ = NULL;
+    return first;
+}
+
+template <typename T>
+void
+List<T>::discard(Node* first, Node* last, const size_type count, Node*& discarded)
+{
+    Node* tail = last->previous_;
+    unlink(first, last, count);
+    tail->next_ = discarded;
+    discarded = first;
+}
+
+/// Merges two sorted next_ chains; on ties left goes first.
+template <typename T>
+template <typename Compare>
+typename List<T>::Node*
+List<T>::mergeChains(Node* left, Node* right, Compare comparison)
+{
+    Node* head = NULL;
+    Node** tail = &head;
+    while (left != NULL && right != NULL) {
+        if (comparison(right->data_, left->data_)) {
+            *tail = right;
+            right = right->next_;
+        } else {
+            *tail = left;
+            left = left->next_;
+        }
+        tail = &(*tail)->next_;
+    }
+    *tail = (left != NULL ? left : right);
+    return head;
+}
+
+template <typename T>
+template <typename Compare>
+typename List<T>::Node*
+List<T>::medianOfThree(Node* a, Node* b, Node* c, Compare comparison)
+{
+    if (comparison(a->data_, b->data_)) {
+        if (comparison(b->data_, c->data_)) return b;
+        return comparison(a->data_, c->data_) ? c : a;
+    }
+    if (comparison(a->data_, c->data_)) return a;
+    return comparison(b->data_, c->data_) ? c : b;
+}
+
+/// Appends the chain chainFirst..chainLast to first..last; an empty chain
+/// is a no-op.
+template <typename T>
+void
+List<T>::join(Node*& first, Node*& last, Node* chainFirst, Node* chainLast)
+{
+    if (NULL == chainFirst) return;
+    if (last != NULL) {
+        last->next_ = chainFirst;
+        chainFirst->previous_ = last;
+    } else {
+        first = chainFirst;
+    }
+    last = chainLast;
+}
+
+template <typename T>
+typename List<T>::size_type
+List<T>::distance(const Node* first, const Node* last)
+{
+    size_type count = 0;
+    for ( ; first != last; first = first->next_) {
+        ++count;
+    }
+    return count;
+}
+
+/// Touches the line holding the links and, when the node spans more than
+/// one line, the first PREFETCH_LINES lines of the payload. The rest of a
+/// large T is left to the hardware, so a hop never queues more than
+/// PREFETCH_LINES + 1 requests.
+template <typename T>
+void
+List<T>::prefetch(const Node* node)
+{
+#if defined(__GNUC__)
+    __builtin_prefetch(&node->next_);
+    if (sizeof(Node) > CACHE_LINE) {
+        const char* line = reinterpret_cast<const char*>(&node->data_);
+        const size_type lines = (sizeof(T) + CACHE_LINE - 1) / CACHE_LINE;
+        for (size_type i = 0; i < lines && i < PREFETCH_LINES; ++i) {
+            __builtin_prefetch(line + i * CACHE_LINE);
+        }
+    }
+#else
+    (void)node;
+#endif
+}
+
+template <typename T>
+void
+List<T>::destroy(Node* chain)
+{
+    while (chain != NULL) {
+        Node* next = chain->next_;
+        delete chain;
+        chain = next;
+    }
+}
+
+template <typename T>
+List<T>::const_iterator::const_iterator()
+    : ptr_(NULL)
+{}
+
+template <typename T>
+List<T>::const_iterator::const_iterator(const const_iterator& rhv)
     : ptr_(rhv.ptr_)
 {}
 
@@ -960,3 +1632,159 @@ List<T>::reverse_iterator::operator->() const
     return this->getPtr();
 }
 
+///======================================NODE_HANDLE==========================================
+
+template <typename T>
+List<T>::node_handle::node_handle()
+    : node_(NULL)
+{}
+
+template <typename T>
+List<T>::node_handle::node_handle(const node_handle& rhv)
+    : node_(rhv.release())
+{}
+
+template <typename T>
+List<T>::node_handle::node_handle(Node* node)
+    : node_(node)
+{}
+
+template <typename T>
+List<T>::node_handle::~node_handle()
+{
+    delete node_;
+}
+
+template <typename T>
+typename List<T>::node_handle&
+List<T>::node_handle::operator=(const node_handle& rhv)
+{
+    if (this != &rhv) {
+        delete node_;
+        node_ = rhv.release();
+    }
+    return *this;
+}
+
+template <typename T>
+bool
+List<T>::node_handle::empty() const
+{
+    return NULL == node_;
+}
+
+template <typename T>
+typename List<T>::reference
+List<T>::node_handle::value() const
+{
+    return node_->data_;
+}
+
+template <typename T>
+typename List<T>::Node*
+List<T>::node_handle::release() const
+{
+    Node* node = node_;
+    node_ = NULL;
+    return node;
+}
+
+///==================================CONST_PREFETCH_ITERATOR=================================
+
+template <typename T>
+List<T>::const_prefetch_iterator::const_prefetch_iterator()
+    : ptr_(NULL)
+    , ahead_(NULL)
+{}
+
+template <typename T>
+List<T>::const_prefetch_iterator::const_prefetch_iterator(const const_prefetch_iterator& rhv)
+    : ptr_(rhv.ptr_)
+    , ahead_(rhv.ahead_)
+{}
+
+template <typename T>
+List<T>::const_prefetch_iterator::const_prefetch_iterator(Node* node, size_type distance)
+    : ptr_(node)
+    , ahead_(node)
+{
+    /// the sentinel is the only node without a successor
+    for ( ; distance > 0 && ahead_->next_ != NULL; --distance) {
+        ahead_ = ahead_->next_;
+        List<T>::prefetch(ahead_);
+    }
+}
+
+template <typename T>
+List<T>::const_prefetch_iterator::~const_prefetch_iterator()
+{
+    ptr_ = NULL;
+    ahead_ = NULL;
+}
+
+template <typename T>
+typename List<T>::const_prefetch_iterator&
+List<T>::const_prefetch_iterator::operator=(const const_prefetch_iterator& rhv)
+{
+    if (this != &rhv) {
+        ptr_ = rhv.ptr_;
+        ahead_ = rhv.ahead_;
+    }
+    return *this;
+}
+
+template <typename T>
+typename List<T>::const_reference
+List<T>::const_prefetch_iterator::operator*() const
+{
+    return ptr_->data_;
+}
+
+template <typename T>
+typename List<T>::Node*
+List<T>::const_prefetch_iterator::operator->() const
+{
+    return ptr_;
+}
+
+template <typename T>
+typename List<T>::const_prefetch_iterator&
+List<T>::const_prefetch_iterator::operator++()
+{
+    ptr_ = ptr_->next_;
+    if (ahead_->next_ != NULL) {
+        ahead_ = ahead_->next_;
+        List<T>::prefetch(ahead_);
+    }
+    return *this;
+}
+
+template <typename T>
+typename List<T>::const_prefetch_iterator
+List<T>::const_prefetch_iterator::operator++(int)
+{
+    const_prefetch_iterator temp(*this);
+    ++(*this);
+    return temp;
+}
+
+template <typename T>
+bool
+List<T>::const_prefetch_iterator::operator==(const const_prefetch_iterator& rhv) const
+{
+    return ptr_ == rhv.ptr_;
+}
+
+template <typename T>
+bool
+List<T>::const_prefetch_iterator::operator!=(const const_prefetch_iterator& rhv) const
+{
+    return !(*this == rhv);
+}
+
+template <typename T>
+typename List<T>::const_iterator
+List<T>::const_prefetch_iterator::base() const
+{
+    return const_iterator(ptr_);
+}
@@ -0,0 +1,158 @@
+#include "../headers/LockFreeList.hpp"
+#include "../headers/Atomic.hpp"
+#include <cstddef>
+
+template <typename T, typename Compare>
+LockFreeList<T, Compare>::LockFreeList(Compare comparison)
+    : head_(new Node())
+    , comparison_(comparison)
+    , size_(0)
+    , reclaimer_()
+{}
+
+/// Marked nodes still on the chain are freed here; snipped ones belong to the
+/// reclaimer.
+template <typename T, typename Compare>
+LockFreeList<T, Compare>::~LockFreeList()
+{
+    while (head_ != NULL) {
+        Node* next = unmark(head_->next_);
+        delete head_;
+        head_ = next;
+    }
+}
+
+template <typename T, typename Compare>
+bool
+LockFreeList<T, Compare>::insert(const_reference value)
+{
+    Node* node = new Node(value);
+    Guard guard(reclaimer_);
+    for (;;) {
+        Node* previous = NULL;
+        Node* current = NULL;
+        if (search(value, previous, current)) {
+            delete node;
+            return false;
+        }
+        node->next_ = current;
+        if (Atomic::compareExchange(&previous->next_, current, node)) {
+            Atomic::fetchAdd(&size_, static_cast<size_type>(1));
+            return true;
+        }
+    }
+}
+
+/// The thread whose mark sticks owns the erase; the snip is best effort and
+/// left to later traversals when it loses a race.
+template <typename T, typename Compare>
+bool
+LockFreeList<T, Compare>::erase(const_reference value)
+{
+    Guard guard(reclaimer_);
+    for (;;) {
+        Node* previous = NULL;
+        Node* current = NULL;
+        if (!search(value, previous, current)) {
+            return false;
+        }
+        Node* next = Atomic::load(&current->next_);
+        if (isMarked(next)) {
+            continue;
+        }
+        if (!Atomic::compareExchange(&current->next_, next, mark(next))) {
+            continue;
+        }
+        Atomic::fetchAdd(&size_, static_cast<size_type>(-1));
+        Node* expected = current;
+        if (Atomic::compareExchange(&previous->next_, expected, next)) {
+            reclaimer_.retire(current);
+        } else {
+            search(value, previous, current);
+        }
+        return true;
+    }
+}
+
+/// Read-only walk: marked nodes are stepped over, never snipped, so the
+/// cost is bounded by the nodes in front of the value.
+template <typename T, typename Compare>
+bool
+LockFreeList<T, Compare>::contains(const_reference value) const
+{
+    Guard guard(reclaimer_);
+    Node* current = unmark(Atomic::load(&head_->next_));
+    while (current != NULL && comparison_(current->data_, value)) {
+        current = unmark(Atomic::load(&current->next_));
+    }
+    return current != NULL
+        && !comparison_(value, current->data_)
+        && !isMarked(Atomic::load(&current->next_));
+}
+
+template <typename T, typename Compare>
+typename LockFreeList<T, Compare>::size_type
+LockFreeList<T, Compare>::size() const
+{
+    return Atomic::load(&size_);
+}
+
+template <typename T, typename Compare>
+bool
+LockFreeList<T, Compare>::empty() const
+{
+    return 0 == size();
+}
+
+/// Positions previous/current around value: current is the first unmarked
+/// node not less than value, previous its unmarked predecessor. Marked nodes
+/// met on the way are snipped and retired. Caller must be pinned.
+template <typename T, typename Compare>
+bool
+LockFreeList<T, Compare>::search(const_reference value, Node*& previous, Node*& current)
+{
+retry:
+    previous = head_;
+    current = Atomic::load(&previous->next_);
+    for (;;) {
+        if (NULL == current) {
+            return false;
+        }
+        Node* next = Atomic::load(&current->next_);
+        if (isMarked(next)) {
+            Node* expected = current;
+            if (!Atomic::compareExchange(&previous->next_, expected, unmark(next))) {
+                goto retry;
+            }
+            reclaimer_.retire(current);
+            current = unmark(next);
+            continue;
+        }
+        if (!comparison_(current->data_, value)) {
+            return !comparison_(value, current->data_);
+        }
+        previous = current;
+        current = next;
+    }
+}
+
+template <typename T, typename Compare>
+bool
+LockFreeList<T, Compare>::isMarked(const Node* next)
+{
+    return 0 != (reinterpret_cast<size_t>(next) & 1);
+}
+
+template <typename T, typename Compare>
+typename LockFreeList<T, Compare>::Node*
+LockFreeList<T, Compare>::mark(const Node* next)
+{
+    return reinterpret_cast<Node*>(reinterpret_cast<size_t>(next) | 1);
+}
+
+template <typename T, typename Compare>
+typename LockFreeList<T, Compare>::Node*
+LockFreeList<T, Compare>::unmark(const Node* next)
+{
+    return reinterpret_cast<Node*>(reinterpret_cast<size_t>(next) & ~static_cast<size_t>(1));
+}
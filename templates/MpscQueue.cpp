@@ -0,0 +1,183 @@
+#include "../headers/MpscQueue.hpp"
+#include "../headers/Atomic.hpp"
+#include <cstddef>
+
+template <typename T>
+MpscQueue<T>::MpscQueue()
+    : head_(NULL)
+    , tail_(NULL)
+    , stub_(new Node())
+    , free_(NULL)
+{
+    head_ = stub_;
+    tail_ = stub_;
+}
+
+/// Producer handles must be gone by now.
+template <typename T>
+MpscQueue<T>::~MpscQueue()
+{
+    while (head_ != NULL) {
+        Node* next = head_->next_;
+        if (head_ != stub_) {
+            delete head_;
+        }
+        head_ = next;
+    }
+    delete stub_;
+    destroy(free_);
+}
+
+template <typename T>
+void
+MpscQueue<T>::push(const_reference value)
+{
+    enqueue(new Node(value));
+}
+
+/// Consumer only.
+template <typename T>
+bool
+MpscQueue<T>::pop(reference value)
+{
+    Node* node = dequeue();
+    if (NULL == node) {
+        return false;
+    }
+    value = node->data_;
+    recycle(node, node);
+    return true;
+}
+
+/// Consumer only. Moves everything published so far to the back of list;
+/// the nodes themselves change hands, the values are not touched.
+template <typename T>
+typename MpscQueue<T>::size_type
+MpscQueue<T>::drain_into(List<T>& list)
+{
+    Node* first = NULL;
+    Node* last = NULL;
+    size_type count = 0;
+    for (Node* node = dequeue(); node != NULL; node = dequeue(), ++count) {
+        node->previous_ = last;
+        if (last != NULL) {
+            last->next_ = node;
+        } else {
+            first = node;
+        }
+        last = node;
+    }
+    if (first != NULL) {
+        list.link(first, last, list.end_, count);
+    }
+    return count;
+}
+
+/// Consumer only.
+template <typename T>
+bool
+MpscQueue<T>::empty() const
+{
+    return head_ == stub_ && NULL == Atomic::load(&stub_->next_);
+}
+
+template <typename T>
+void
+MpscQueue<T>::enqueue(Node* node)
+{
+    node->next_ = NULL;
+    Node* previous = Atomic::exchange(&tail_, node);
+    Atomic::store(&previous->next_, node);
+}
+
+/// Returns the oldest node, or NULL if none is fully linked yet. When the
+/// queue would run dry the stub is pushed back behind the last node, so
+/// that node can be handed out while producers keep a valid tail.
+template <typename T>
+typename MpscQueue<T>::Node*
+MpscQueue<T>::dequeue()
+{
+    Node* head = head_;
+    Node* next = Atomic::load(&head->next_);
+    if (head == stub_) {
+        if (NULL == next) {
+            return NULL;
+        }
+        head_ = next;
+        head = next;
+        next = Atomic::load(&next->next_);
+    }
+    if (next != NULL) {
+        head_ = next;
+        return head;
+    }
+    if (head != Atomic::load(&tail_)) {
+        return NULL;
+    }
+    enqueue(stub_);
+    next = Atomic::load(&head->next_);
+    if (next != NULL) {
+        head_ = next;
+        return head;
+    }
+    return NULL;
+}
+
+/// Pushes the chain first..last (linked through next_) on the free stack.
+/// Only whole-stack exchanges ever take from it, so the push is ABA-free.
+template <typename T>
+void
+MpscQueue<T>::recycle(Node* first, Node* last)
+{
+    last->next_ = Atomic::load(&free_);
+    while (!Atomic::compareExchange(&free_, last->next_, first)) {}
+}
+
+template <typename T>
+void
+MpscQueue<T>::destroy(Node* chain)
+{
+    while (chain != NULL) {
+        Node* next = chain->next_;
+        delete chain;
+        chain = next;
+    }
+}
+
+///======================================PRODUCER============================================
+
+template <typename T>
+MpscQueue<T>::Producer::Producer(MpscQueue<T>& queue)
+    : queue_(queue)
+    , cache_(NULL)
+{}
+
+template <typename T>
+MpscQueue<T>::Producer::~Producer()
+{
+    if (cache_ != NULL) {
+        Node* last = cache_;
+        while (last->next_ != NULL) {
+            last = last->next_;
+        }
+        queue_.recycle(cache_, last);
+    }
+}
+
+template <typename T>
+void
+MpscQueue<T>::Producer::push(const_reference value)
+{
+    if (NULL == cache_) {
+        cache_ = Atomic::exchange(&queue_.free_, static_cast<Node*>(NULL));
+    }
+    if (NULL == cache_) {
+        queue_.enqueue(new Node(value));
+        return;
+    }
+    Node* node = cache_;
+    cache_ = node->next_;
+    node->data_ = value;
+    node->previous_ = NULL;
+    queue_.enqueue(node);
+}
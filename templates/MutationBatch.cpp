@@ -0,0 +1,169 @@
+#include "../headers/MutationBatch.hpp"
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
+template <typename T>
+void
+MutationBatch<T>::insert(const size_type index, const T& value)
+{
+    add(index, iterator(), false, false);
+    values_.push_back(value);
+}
+
+template <typename T>
+void
+MutationBatch<T>::insert(iterator position, const T& value)
+{
+    add(0, position, true, false);
+    values_.push_back(value);
+}
+
+template <typename T>
+void
+MutationBatch<T>::erase(const size_type index)
+{
+    add(index, iterator(), false, true);
+}
+
+template <typename T>
+void
+MutationBatch<T>::erase(iterator position)
+{
+    add(0, position, true, true);
+}
+
+template <typename T>
+typename MutationBatch<T>::size_type
+MutationBatch<T>::size() const
+{
+    return operations_.size();
+}
+
+template <typename T>
+bool
+MutationBatch<T>::empty() const
+{
+    return operations_.empty();
+}
+
+template <typename T>
+void
+MutationBatch<T>::clear()
+{
+    operations_.clear();
+    values_.clear();
+}
+
+template <typename T>
+void
+MutationBatch<T>::add(const size_type index, iterator position, const bool pinned, const bool erase)
+{
+    Operation operation;
+    operation.index_ = index;
+    operation.position_ = position;
+    operation.value_ = values_.size();
+    operation.pinned_ = pinned;
+    operation.erase_ = erase;
+    operations_.push_back(operation);
+}
+
+///======================================LIST================================================
+
+/// Index keys are sorted up front and iterator keys are looked up by node,
+/// so a single walk from the front, stopping at the last position touched,
+/// applies the whole batch. Keys are checked, inserted nodes created and
+/// scratch space reserved before the walk starts, which then only relinks
+/// and cannot throw. Returns false, with the list untouched, when a key
+/// is out of range; if copying a value or reserving throws, the nodes
+/// made so far are freed and the list is untouched as well.
+template <typename T>
+bool
+List<T>::apply(const MutationBatch<T>& batch)
+{
+    typedef typename MutationBatch<T>::Operation Operation;
+    typedef std::pair<size_type, size_type> Keyed;   ///< index, operation
+    typedef std::pair<Node*, size_type> Pinned;      ///< node, operation
+
+    const std::vector<Operation>& operations = batch.operations_;
+    std::vector<Keyed> keyed;
+    std::vector<Pinned> pinned;
+    for (size_type i = 0; i < operations.size(); ++i) {
+        const Operation& operation = operations[i];
+        if (operation.pinned_) {
+            Node* position = operation.position_.getPtr();
+            if (NULL == position || (operation.erase_ && position == end_)) {
+                return false;
+            }
+            pinned.push_back(Pinned(position, i));
+        } else {
+            if (operation.index_ > size_ || (operation.erase_ && operation.index_ == size_)) {
+                return false;
+            }
+            keyed.push_back(Keyed(operation.index_, i));
+        }
+    }
+
+    /// every allocation happens here, so the walk below cannot throw
+    std::vector<Node*> created(operations.size(), static_cast<Node*>(NULL));
+    std::vector<size_type> here;
+    try {
+        here.reserve(operations.size());
+        for (size_type i = 0; i < operations.size(); ++i) {
+            if (!operations[i].erase_) {
+                created[i] = new Node(batch.values_[operations[i].value_]);
+            }
+        }
+    } catch (...) {
+        for (size_type i = 0; i < created.size(); ++i) {
+            delete created[i];
+        }
+        throw;
+    }
+    std::sort(keyed.begin(), keyed.end());
+    std::sort(pinned.begin(), pinned.end());
+
+    size_type remaining = operations.size();
+    typename std::vector<Keyed>::const_iterator nextKeyed = keyed.begin();
+    Node* node = begin_;
+    for (size_type index = 0; remaining != 0; ++index) {
+        here.clear();
+        for (; nextKeyed != keyed.end() && nextKeyed->first == index; ++nextKeyed) {
+            here.push_back(nextKeyed->second);
+        }
+        if (!pinned.empty()) {
+            typename std::vector<Pinned>::const_iterator match =
+                std::lower_bound(pinned.begin(), pinned.end(), Pinned(node, 0));
+            for (; match != pinned.end() && match->first == node; ++match) {
+                here.push_back(match->second);
+            }
+        }
+        std::sort(here.begin(), here.end());
+
+        bool erase = false;
+        for (size_type i = 0; i < here.size(); ++i) {
+            if (operations[here[i]].erase_) {
+                erase = true;
+            } else {
+                link(created[here[i]], node);
+                created[here[i]] = NULL;
+            }
+        }
+        remaining -= here.size();
+        if (node == end_) {
+            break;
+        }
+        Node* next = node->next_;
+        if (erase) {
+            destroy(unlink(node, next, 1));
+        }
+        node = next;
+    }
+
+    /// only an iterator into another list can leave an insert unapplied
+    assert(0 == remaining);
+    for (size_type i = 0; i < created.size(); ++i) {
+        delete created[i];
+    }
+    return true;
+}
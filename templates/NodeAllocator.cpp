@@ -0,0 +1,154 @@
+#include "../headers/NodeAllocator.hpp"
+#include "../headers/Atomic.hpp"
+#include <cassert>
+#include <cstddef>
+#include <new>
+
+template <size_t Size>
+__thread typename NodeAllocator<Size>::Cache* NodeAllocator<Size>::local_ = NULL;
+
+template <size_t Size>
+pthread_once_t NodeAllocator<Size>::once_ = PTHREAD_ONCE_INIT;
+
+template <size_t Size>
+pthread_key_t NodeAllocator<Size>::key_;
+
+template <size_t Size>
+pthread_mutex_t NodeAllocator<Size>::registry_ = PTHREAD_MUTEX_INITIALIZER;
+
+template <size_t Size>
+typename NodeAllocator<Size>::Cache* NodeAllocator<Size>::caches_ = NULL;
+
+template <size_t Size>
+typename NodeAllocator<Size>::Cache* NodeAllocator<Size>::orphans_ = NULL;
+
+template <size_t Size>
+void*
+NodeAllocator<Size>::allocate()
+{
+    Cache* cache = local();
+    if (NULL == cache->free_) {
+        cache->free_ = Atomic::exchange(&cache->remote_, static_cast<Block*>(NULL));
+        if (NULL == cache->free_) {
+            refill(cache);
+        }
+    }
+    Block* block = cache->free_;
+    cache->free_ = block->next_;
+    return reinterpret_cast<char*>(block) + sizeof(Block);
+}
+
+template <size_t Size>
+void
+NodeAllocator<Size>::deallocate(void* pointer)
+{
+    if (NULL == pointer) {
+        return;
+    }
+    Block* block = reinterpret_cast<Block*>(static_cast<char*>(pointer) - sizeof(Block));
+    Cache* cache = local();
+    if (block->owner_ == cache) {
+        block->next_ = cache->free_;
+        cache->free_ = block;
+        return;
+    }
+    if (cache->outgoingOwner_ != block->owner_ || BATCH == cache->outgoingCount_) {
+        flush(cache);
+        cache->outgoingOwner_ = block->owner_;
+        cache->outgoingLast_ = block;
+    }
+    block->next_ = cache->outgoingFirst_;
+    cache->outgoingFirst_ = block;
+    ++cache->outgoingCount_;
+}
+
+/// The calling thread's cache: an orphan if one is waiting, a new one otherwise.
+template <size_t Size>
+typename NodeAllocator<Size>::Cache*
+NodeAllocator<Size>::local()
+{
+    if (local_ != NULL) {
+        return local_;
+    }
+    ::pthread_once(&once_, createKey);
+    ::pthread_mutex_lock(&registry_);
+    Cache* cache = orphans_;
+    if (cache != NULL) {
+        orphans_ = cache->next_;
+    } else {
+        cache = new Cache();
+    }
+    cache->next_ = caches_;
+    caches_ = cache;
+    ::pthread_mutex_unlock(&registry_);
+    ::pthread_setspecific(key_, cache);
+    local_ = cache;
+    return cache;
+}
+
+/// Carves a slab of SLAB blocks owned by cache.
+template <size_t Size>
+void
+NodeAllocator<Size>::refill(Cache* cache)
+{
+    char* memory = static_cast<char*>(::operator new(sizeof(Slab) + SLAB * BLOCK));
+    Slab* slab = reinterpret_cast<Slab*>(memory);
+    slab->next_ = cache->slabs_;
+    cache->slabs_ = slab;
+
+    Block* first = NULL;
+    for (int i = SLAB - 1; i >= 0; --i) {
+        Block* block = reinterpret_cast<Block*>(memory + sizeof(Slab) + i * BLOCK);
+        block->owner_ = cache;
+        block->next_ = first;
+        first = block;
+    }
+    cache->free_ = first;
+}
+
+/// Hands the outgoing batch to its owner with a single CAS.
+template <size_t Size>
+void
+NodeAllocator<Size>::flush(Cache* cache)
+{
+    if (0 == cache->outgoingCount_) {
+        return;
+    }
+    Cache* owner = cache->outgoingOwner_;
+    Block* head = Atomic::loadRelaxed(&owner->remote_);
+    do {
+        cache->outgoingLast_->next_ = head;
+    } while (!Atomic::compareExchange(&owner->remote_, head, cache->outgoingFirst_));
+    cache->outgoingOwner_ = NULL;
+    cache->outgoingFirst_ = NULL;
+    cache->outgoingLast_ = NULL;
+    cache->outgoingCount_ = 0;
+}
+
+/// Thread exit: the pending batch goes home and the cache waits for adoption.
+/// Its blocks stay valid, so frees from other threads keep landing on it.
+template <size_t Size>
+void
+NodeAllocator<Size>::release(void* argument)
+{
+    Cache* cache = static_cast<Cache*>(argument);
+    assert(cache != NULL);
+    flush(cache);
+    ::pthread_mutex_lock(&registry_);
+    Cache** link = &caches_;
+    while (*link != cache) {
+        link = &(*link)->next_;
+    }
+    *link = cache->next_;
+    cache->next_ = orphans_;
+    orphans_ = cache;
+    ::pthread_mutex_unlock(&registry_);
+    local_ = NULL;
+}
+
+template <size_t Size>
+void
+NodeAllocator<Size>::createKey()
+{
+    ::pthread_key_create(&key_, release);
+}
@@ -0,0 +1,373 @@
+#include "../headers/OrientedList.hpp"
+#include <cstddef>
+
+///=====================================ORIENTED_LIST====================================================
+
+template <typename T>
+OrientedList<T>::OrientedList()
+    : list_()
+    , reversed_(false)
+{}
+
+template <typename T>
+OrientedList<T>::OrientedList(const List<T>& list)
+    : list_(list)
+    , reversed_(false)
+{}
+
+template <typename T>
+void
+OrientedList<T>::reverse()
+{
+    reversed_ = !reversed_;
+}
+
+template <typename T>
+void
+OrientedList<T>::normalize()
+{
+    if (reversed_) {
+        list_.reverse();
+        reversed_ = false;
+    }
+}
+
+template <typename T>
+bool
+OrientedList<T>::reversed() const
+{
+    return reversed_;
+}
+
+template <typename T>
+typename OrientedList<T>::iterator
+OrientedList<T>::insert(iterator position, const_reference value)
+{
+    return iterator(&list_, list_.insert(physical(position), value), reversed_);
+}
+
+template <typename T>
+typename OrientedList<T>::iterator
+OrientedList<T>::erase(iterator position)
+{
+    iterator next = position;
+    ++next;
+    list_.erase(position.getIt());
+    return next;
+}
+
+template <typename T>
+void
+OrientedList<T>::push_back(const_reference value)
+{
+    reversed_ ? list_.push_front(value) : list_.push_back(value);
+}
+
+template <typename T>
+void
+OrientedList<T>::push_front(const_reference value)
+{
+    reversed_ ? list_.push_back(value) : list_.push_front(value);
+}
+
+template <typename T>
+void
+OrientedList<T>::pop_back()
+{
+    reversed_ ? list_.pop_front() : list_.pop_back();
+}
+
+template <typename T>
+void
+OrientedList<T>::pop_front()
+{
+    reversed_ ? list_.pop_back() : list_.pop_front();
+}
+
+template <typename T>
+typename OrientedList<T>::reference
+OrientedList<T>::front()
+{
+    return reversed_ ? list_.back() : list_.front();
+}
+
+template <typename T>
+typename OrientedList<T>::const_reference
+OrientedList<T>::front() const
+{
+    return reversed_ ? list_.back() : list_.front();
+}
+
+template <typename T>
+typename OrientedList<T>::reference
+OrientedList<T>::back()
+{
+    return reversed_ ? list_.front() : list_.back();
+}
+
+template <typename T>
+typename OrientedList<T>::const_reference
+OrientedList<T>::back() const
+{
+    return reversed_ ? list_.front() : list_.back();
+}
+
+/// rhv keeps its logical order; it is relinked only if the orientations differ
+template <typename T>
+void
+OrientedList<T>::splice(iterator position, OrientedList<T>& rhv)
+{
+    if (&rhv == this) return;
+
+    if (rhv.reversed_ != reversed_) {
+        rhv.list_.reverse();
+        rhv.reversed_ = reversed_;
+    }
+    list_.splice(physical(position), rhv.list_);
+}
+
+template <typename T>
+void
+OrientedList<T>::splice(iterator position, OrientedList<T>& rhv, iterator index)
+{
+    list_.splice(physical(position), rhv.list_, index.getIt());
+}
+
+template <typename T>
+typename OrientedList<T>::size_type
+OrientedList<T>::size() const
+{
+    return list_.size();
+}
+
+template <typename T>
+bool
+OrientedList<T>::empty() const
+{
+    return list_.empty();
+}
+
+template <typename T>
+void
+OrientedList<T>::clear()
+{
+    list_.clear();
+}
+
+template <typename T>
+typename OrientedList<T>::const_iterator
+OrientedList<T>::begin() const
+{
+    List<T>* list = const_cast<List<T>*>(&list_);
+    if (reversed_ && !list_.empty()) {
+        typename List<T>::iterator last = list->end();
+        --last;
+        return const_iterator(list, last, true);
+    }
+    return const_iterator(list, list->begin(), reversed_);
+}
+
+template <typename T>
+typename OrientedList<T>::const_iterator
+OrientedList<T>::end() const
+{
+    List<T>* list = const_cast<List<T>*>(&list_);
+    return const_iterator(list, list->end(), reversed_);
+}
+
+template <typename T>
+typename OrientedList<T>::iterator
+OrientedList<T>::begin()
+{
+    if (reversed_ && !list_.empty()) {
+        typename List<T>::iterator last = list_.end();
+        --last;
+        return iterator(&list_, last, true);
+    }
+    return iterator(&list_, list_.begin(), reversed_);
+}
+
+template <typename T>
+typename OrientedList<T>::iterator
+OrientedList<T>::end()
+{
+    return iterator(&list_, list_.end(), reversed_);
+}
+
+/// Physical insertion point for "before position" in the logical order:
+/// reversed, that is right after position, or before the physical head for end().
+template <typename T>
+typename List<T>::iterator
+OrientedList<T>::physical(iterator position)
+{
+    typename List<T>::iterator it = position.getIt();
+    if (!reversed_) return it;
+    if (it == list_.end()) return list_.begin();
+    ++it;
+    return it;
+}
+
+///==================================CONST_ITERATOR===============================================================
+/// The reversed end() is the physical end sentinel, so both orientations
+/// share one past-the-end position.
+template <typename T>
+OrientedList<T>::const_iterator::const_iterator()
+    : owner_(NULL)
+    , it_()
+    , reversed_(false)
+{}
+
+template <typename T>
+OrientedList<T>::const_iterator::const_iterator(const const_iterator& rhv)
+    : owner_(rhv.owner_)
+    , it_(rhv.it_)
+    , reversed_(rhv.reversed_)
+{}
+
+template <typename T>
+OrientedList<T>::const_iterator::const_iterator(List<T>* owner, typename List<T>::iterator it, const bool reversed)
+    : owner_(owner)
+    , it_(it)
+    , reversed_(reversed)
+{}
+
+template <typename T>
+OrientedList<T>::const_iterator::~const_iterator()
+{
+    owner_ = NULL;
+}
+
+template <typename T>
+typename OrientedList<T>::const_iterator&
+OrientedList<T>::const_iterator::operator=(const const_iterator& rhv)
+{
+    if (this != &rhv) {
+        owner_ = rhv.owner_;
+        it_ = rhv.it_;
+        reversed_ = rhv.reversed_;
+    }
+    return *this;
+}
+
+template <typename T>
+typename OrientedList<T>::const_reference
+OrientedList<T>::const_iterator::operator*() const
+{
+    return *it_;
+}
+
+template <typename T>
+typename OrientedList<T>::const_pointer
+OrientedList<T>::const_iterator::operator->() const
+{
+    return &*it_;
+}
+
+template <typename T>
+typename OrientedList<T>::const_iterator&
+OrientedList<T>::const_iterator::operator++()
+{
+    if (!reversed_) {
+        ++it_;
+    } else if (it_ == owner_->begin()) {
+        it_ = owner_->end();
+    } else {
+        --it_;
+    }
+    return *this;
+}
+
+template <typename T>
+typename OrientedList<T>::const_iterator
+OrientedList<T>::const_iterator::operator++(int)
+{
+    const_iterator temp(*this);
+    ++(*this);
+    return temp;
+}
+
+template <typename T>
+typename OrientedList<T>::const_iterator&
+OrientedList<T>::const_iterator::operator--()
+{
+    if (!reversed_) {
+        --it_;
+    } else if (it_ == owner_->end()) {
+        it_ = owner_->begin();
+    } else {
+        ++it_;
+    }
+    return *this;
+}
+
+template <typename T>
+typename OrientedList<T>::const_iterator
+OrientedList<T>::const_iterator::operator--(int)
+{
+    const_iterator temp(*this);
+    --(*this);
+    return temp;
+}
+
+template <typename T>
+bool
+OrientedList<T>::const_iterator::operator==(const const_iterator& rhv) const
+{
+    return it_ == rhv.it_;
+}
+
+template <typename T>
+bool
+OrientedList<T>::const_iterator::operator!=(const const_iterator& rhv) const
+{
+    return !(*this == rhv);
+}
+
+template <typename T>
+typename List<T>::iterator
+OrientedList<T>::const_iterator::getIt() const
+{
+    return it_;
+}
+
+///===================================ITERATOR===============================================================
+template <typename T>
+OrientedList<T>::iterator::iterator()
+    : const_iterator()
+{}
+
+template <typename T>
+OrientedList<T>::iterator::iterator(const iterator& rhv)
+    : const_iterator(rhv)
+{}
+
+template <typename T>
+OrientedList<T>::iterator::iterator(List<T>* owner, typename List<T>::iterator it, const bool reversed)
+    : const_iterator(owner, it, reversed)
+{}
+
+template <typename T>
+OrientedList<T>::iterator::~iterator()
+{}
+
+template <typename T>
+typename OrientedList<T>::iterator&
+OrientedList<T>::iterator::operator=(const iterator& rhv)
+{
+    const_iterator::operator=(rhv);
+    return *this;
+}
+
+template <typename T>
+typename OrientedList<T>::reference
+OrientedList<T>::iterator::operator*() const
+{
+    return *this->getIt();
+}
+
+template <typename T>
+typename OrientedList<T>::pointer
+OrientedList<T>::iterator::operator->() const
+{
+    return &*this->getIt();
+}
@@ -0,0 +1,377 @@
+#include "../headers/ParallelList.hpp"
+#include "../headers/Atomic.hpp"
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+///======================================SEGMENTS============================================
+
+/// Fills bounds with segment starts plus last; leaves it with a single
+/// segment when the range is too short to be worth splitting.
+template <typename Iterator>
+void
+parallelSplit(const ParallelPolicy& policy, Iterator first, Iterator last, std::vector<Iterator>& bounds)
+{
+    const size_t grain = std::max(policy.grain_, static_cast<size_t>(1));
+    std::vector<Iterator> samples;
+    size_t count = 0;
+    for (Iterator it = first; it != last; ++it, ++count) {
+        if (0 == count % grain) {
+            samples.push_back(it);
+        }
+    }
+
+    const size_t segments = std::min(samples.size(), policy.pool().size() * 4);
+    bounds.clear();
+    if (segments < 2) {
+        bounds.push_back(first);
+    } else {
+        for (size_t segment = 0; segment < segments; ++segment) {
+            bounds.push_back(samples[segment * samples.size() / segments]);
+        }
+    }
+    bounds.push_back(last);
+}
+
+/// Runs jobs[1..] on the pool and jobs[0] on the calling thread.
+template <typename Job>
+void
+parallelRun(const ParallelPolicy& policy, std::vector<Job>& jobs)
+{
+    ThreadPool::TaskGroup group(policy.pool());
+    for (size_t i = 1; i < jobs.size(); ++i) {
+        group.run(&Job::run, &jobs[i]);
+    }
+    Job::run(&jobs[0]);
+    group.wait();
+}
+
+template <typename Iterator, typename Predicate>
+struct ParallelCount
+{
+    ParallelCount(Iterator first, Iterator last, Predicate predicate)
+        : first_(first), last_(last), predicate_(predicate), result_(0) {}
+
+    static void run(void* self)
+    {
+        ParallelCount* job = static_cast<ParallelCount*>(self);
+        for (Iterator it = job->first_; it != job->last_; ++it) {
+            if (job->predicate_(*it)) {
+                ++job->result_;
+            }
+        }
+    }
+
+    Iterator first_;
+    Iterator last_;
+    Predicate predicate_;
+    size_t result_;
+};
+
+/// Segments give up once an earlier segment has a match.
+template <typename Iterator, typename Predicate>
+struct ParallelFind
+{
+    ParallelFind(Iterator first, Iterator last, Predicate predicate, size_t index, volatile size_t* winner)
+        : first_(first), last_(last), predicate_(predicate), index_(index), winner_(winner), found_(last) {}
+
+    static void run(void* self)
+    {
+        ParallelFind* job = static_cast<ParallelFind*>(self);
+        for (Iterator it = job->first_; it != job->last_; ++it) {
+            if (Atomic::loadRelaxed(job->winner_) < job->index_) {
+                return;
+            }
+            if (job->predicate_(*it)) {
+                job->found_ = it;
+                size_t current = Atomic::load(job->winner_);
+                while (job->index_ < current && !Atomic::compareExchange(job->winner_, current, job->index_)) {}
+                return;
+            }
+        }
+    }
+
+    Iterator first_;
+    Iterator last_;
+    Predicate predicate_;
+    size_t index_;
+    volatile size_t* winner_;
+    Iterator found_;
+};
+
+/// Segments after the first start from their own first element, so no
+/// identity value is needed.
+template <typename Iterator, typename T, typename BinaryOperation>
+struct ParallelAccumulate
+{
+    ParallelAccumulate(Iterator first, Iterator last, const T& init, bool seeded, BinaryOperation operation)
+        : first_(first), last_(last), result_(init), seeded_(seeded), operation_(operation) {}
+
+    static void run(void* self)
+    {
+        ParallelAccumulate* job = static_cast<ParallelAccumulate*>(self);
+        Iterator it = job->first_;
+        if (!job->seeded_) {
+            job->result_ = *it;
+            ++it;
+        }
+        for ( ; it != job->last_; ++it) {
+            job->result_ = job->operation_(job->result_, *it);
+        }
+    }
+
+    Iterator first_;
+    Iterator last_;
+    T result_;
+    bool seeded_;
+    BinaryOperation operation_;
+};
+
+template <typename Iterator, typename Function>
+struct ParallelForEach
+{
+    ParallelForEach(Iterator first, Iterator last, Function function)
+        : first_(first), last_(last), function_(function) {}
+
+    static void run(void* self)
+    {
+        ParallelForEach* job = static_cast<ParallelForEach*>(self);
+        for (Iterator it = job->first_; it != job->last_; ++it) {
+            job->function_(*it);
+        }
+    }
+
+    Iterator first_;
+    Iterator last_;
+    Function function_;
+};
+
+template <typename Iterator, typename Predicate>
+Iterator
+parallelFind(const ParallelPolicy& policy, Iterator first, Iterator last, Predicate predicate)
+{
+    std::vector<Iterator> bounds;
+    parallelSplit(policy, first, last, bounds);
+    volatile size_t winner = bounds.size();
+
+    std::vector<ParallelFind<Iterator, Predicate> > jobs;
+    for (size_t i = 0; i + 1 < bounds.size(); ++i) {
+        jobs.push_back(ParallelFind<Iterator, Predicate>(bounds[i], bounds[i + 1], predicate, i, &winner));
+    }
+    parallelRun(policy, jobs);
+    return winner < jobs.size() ? jobs[winner].found_ : last;
+}
+
+template <typename Iterator, typename Function>
+void
+parallelForEach(const ParallelPolicy& policy, Iterator first, Iterator last, Function function)
+{
+    std::vector<Iterator> bounds;
+    parallelSplit(policy, first, last, bounds);
+
+    std::vector<ParallelForEach<Iterator, Function> > jobs;
+    for (size_t i = 0; i + 1 < bounds.size(); ++i) {
+        jobs.push_back(ParallelForEach<Iterator, Function>(bounds[i], bounds[i + 1], function));
+    }
+    parallelRun(policy, jobs);
+}
+
+///======================================ALGORITHMS==========================================
+
+template <typename T, typename Predicate>
+typename List<T>::size_type
+count_if(const ParallelPolicy& policy, const List<T>& list, Predicate predicate)
+{
+    typedef typename List<T>::const_iterator Iterator;
+    std::vector<Iterator> bounds;
+    parallelSplit(policy, list.begin(), list.end(), bounds);
+
+    std::vector<ParallelCount<Iterator, Predicate> > jobs;
+    for (size_t i = 0; i + 1 < bounds.size(); ++i) {
+        jobs.push_back(ParallelCount<Iterator, Predicate>(bounds[i], bounds[i + 1], predicate));
+    }
+    parallelRun(policy, jobs);
+
+    typename List<T>::size_type result = 0;
+    for (size_t i = 0; i < jobs.size(); ++i) {
+        result += jobs[i].result_;
+    }
+    return result;
+}
+
+template <typename T, typename Predicate>
+typename List<T>::const_iterator
+find_if(const ParallelPolicy& policy, const List<T>& list, Predicate predicate)
+{
+    return parallelFind(policy, list.begin(), list.end(), predicate);
+}
+
+template <typename T, typename Predicate>
+typename List<T>::iterator
+find_if(const ParallelPolicy& policy, List<T>& list, Predicate predicate)
+{
+    return parallelFind(policy, list.begin(), list.end(), predicate);
+}
+
+template <typename T>
+T
+accumulate(const ParallelPolicy& policy, const List<T>& list, T init)
+{
+    return accumulate(policy, list, init, std::plus<T>());
+}
+
+template <typename T, typename BinaryOperation>
+T
+accumulate(const ParallelPolicy& policy, const List<T>& list, T init, BinaryOperation operation)
+{
+    typedef typename List<T>::const_iterator Iterator;
+    std::vector<Iterator> bounds;
+    parallelSplit(policy, list.begin(), list.end(), bounds);
+
+    std::vector<ParallelAccumulate<Iterator, T, BinaryOperation> > jobs;
+    for (size_t i = 0; i + 1 < bounds.size(); ++i) {
+        jobs.push_back(ParallelAccumulate<Iterator, T, BinaryOperation>(bounds[i], bounds[i + 1], init, 0 == i, operation));
+    }
+    parallelRun(policy, jobs);
+
+    T result = jobs[0].result_;
+    for (size_t i = 1; i < jobs.size(); ++i) {
+        result = operation(result, jobs[i].result_);
+    }
+    return result;
+}
+
+template <typename T, typename Function>
+void
+for_each(const ParallelPolicy& policy, List<T>& list, Function function)
+{
+    parallelForEach(policy, list.begin(), list.end(), function);
+}
+
+template <typename T, typename Function>
+void
+for_each(const ParallelPolicy& policy, const List<T>& list, Function function)
+{
+    parallelForEach(policy, list.begin(), list.end(), function);
+}
+
+///======================================STRUCTURAL==========================================
+
+/// One segment's share of a structural pass: the nodes of [first_, last_)
+/// are split into a matched and a rest chain, both doubly linked and
+/// NULL-terminated. Neighbouring segments only meet at the bound node, whose
+/// links each side leaves alone, so segments run without synchronization.
+template <typename T>
+template <typename Predicate>
+struct List<T>::SegmentSplit
+{
+    SegmentSplit(Node* first, Node* last, Predicate predicate, bool discardMatched)
+        : first_(first), last_(last), predicate_(predicate), discardMatched_(discardMatched)
+        , matchedFirst_(NULL), matchedLast_(NULL), restFirst_(NULL), restLast_(NULL), matched_(0) {}
+
+    static void run(void* self)
+    {
+        SegmentSplit* job = static_cast<SegmentSplit*>(self);
+        for (Node* node = job->first_; node != job->last_; ) {
+            Node* next = node->next_;
+            node->previous_ = NULL;
+            node->next_ = NULL;
+            if (job->predicate_(node->data_)) {
+                List<T>::join(job->matchedFirst_, job->matchedLast_, node, node);
+                ++job->matched_;
+            } else {
+                List<T>::join(job->restFirst_, job->restLast_, node, node);
+            }
+            node = next;
+        }
+        /// the segment's removed nodes are freed here, as one batch per task
+        if (job->discardMatched_) {
+            List<T>::destroy(job->matchedFirst_);
+            job->matchedFirst_ = NULL;
+            job->matchedLast_ = NULL;
+        }
+    }
+
+    Node* first_;
+    Node* last_;
+    Predicate predicate_;
+    bool discardMatched_;
+    Node* matchedFirst_;
+    Node* matchedLast_;
+    Node* restFirst_;
+    Node* restLast_;
+    size_type matched_;
+};
+
+/// Runs the segments on the pool, then stitches their chains together in
+/// list order on the calling thread. The list is left empty; the caller
+/// links the chains back in. predicate must not throw.
+template <typename T>
+template <typename Predicate>
+typename List<T>::size_type
+List<T>::splitSegments(const ParallelPolicy& policy, Predicate predicate, bool discardMatched,
+                       Node*& matchedFirst, Node*& matchedLast, Node*& restFirst, Node*& restLast)
+{
+    std::vector<iterator> bounds;
+    parallelSplit(policy, begin(), end(), bounds);
+
+    std::vector<SegmentSplit<Predicate> > jobs;
+    for (size_t i = 0; i + 1 < bounds.size(); ++i) {
+        jobs.push_back(SegmentSplit<Predicate>(bounds[i].getPtr(), bounds[i + 1].getPtr(), predicate, discardMatched));
+    }
+    parallelRun(policy, jobs);
+
+    resetFinger();
+    begin_ = end_;
+    end_->previous_ = NULL;
+    size_ = 0;
+
+    matchedFirst = matchedLast = restFirst = restLast = NULL;
+    size_type matched = 0;
+    for (size_t i = 0; i < jobs.size(); ++i) {
+        join(matchedFirst, matchedLast, jobs[i].matchedFirst_, jobs[i].matchedLast_);
+        join(restFirst, restLast, jobs[i].restFirst_, jobs[i].restLast_);
+        matched += jobs[i].matched_;
+    }
+    return matched;
+}
+
+template <typename T>
+template <typename Predicate>
+typename List<T>::size_type
+List<T>::remove_if(const ParallelPolicy& policy, Predicate predicate)
+{
+    Node* matchedFirst = NULL;
+    Node* matchedLast = NULL;
+    Node* restFirst = NULL;
+    Node* restLast = NULL;
+    const size_type total = size_;
+    const size_type removed = splitSegments(policy, predicate, true, matchedFirst, matchedLast, restFirst, restLast);
+    if (restFirst != NULL) {
+        link(restFirst, restLast, end_, total - removed);
+    }
+    return removed;
+}
+
+/// Stable, like stable_partition(); returns the first element that does not
+/// satisfy predicate.
+template <typename T>
+template <typename Predicate>
+typename List<T>::iterator
+List<T>::partition(const ParallelPolicy& policy, Predicate predicate)
+{
+    Node* matchedFirst = NULL;
+    Node* matchedLast = NULL;
+    Node* restFirst = NULL;
+    Node* restLast = NULL;
+    const size_type total = size_;
+    const size_type matched = splitSegments(policy, predicate, false, matchedFirst, matchedLast, restFirst, restLast);
+    if (matchedFirst != NULL) {
+        link(matchedFirst, matchedLast, end_, matched);
+    }
+    if (restFirst != NULL) {
+        link(restFirst, restLast, end_, total - matched);
+        return iterator(restFirst);
+    }
+    return end();
+}
@@ -0,0 +1,641 @@
+#include "../headers/RankedList.hpp"
+#include <cstddef>
+#include <cassert>
+
+///=====================================NODE=============================================================
+
+template <typename T>
+RankedList<T>::Node::Node(const_reference data, const size_type height)
+    : data_(data)
+    , previous_(NULL)
+    , next_(NULL)
+    , height_(height)
+    , levels_(height > 1 ? new Link[height - 1] : NULL)
+{
+    for (size_type level = 1; level < height_; ++level) {
+        levels_[level - 1].next_  = NULL;
+        levels_[level - 1].width_ = 1;
+    }
+}
+
+template <typename T>
+RankedList<T>::Node::~Node()
+{
+    delete [] levels_;
+}
+
+///=====================================RANKED_LIST======================================================
+
+template <typename T>
+RankedList<T>::RankedList()
+    : head_(new Node(T(), MAX_LEVEL))
+    , size_(0)
+    , seed_(2463534242u)
+{
+    head_->next_ = head_->previous_ = head_;
+}
+
+template <typename T>
+RankedList<T>::RankedList(const RankedList<T>& rhv)
+    : head_(new Node(T(), MAX_LEVEL))
+    , size_(0)
+    , seed_(2463534242u)
+{
+    head_->next_ = head_->previous_ = head_;
+    for (const_iterator it = rhv.begin(); it != rhv.end(); ++it) {
+        push_back(*it);
+    }
+}
+
+template <typename T>
+template <typename InputIterator>
+RankedList<T>::RankedList(InputIterator first, InputIterator last)
+    : head_(new Node(T(), MAX_LEVEL))
+    , size_(0)
+    , seed_(2463534242u)
+{
+    head_->next_ = head_->previous_ = head_;
+    for (InputIterator it = first; it != last; ++it) {
+        push_back(*it);
+    }
+}
+
+template <typename T>
+RankedList<T>::~RankedList()
+{
+    clear();
+    delete head_;
+}
+
+template <typename T>
+RankedList<T>&
+RankedList<T>::operator=(const RankedList<T>& rhv)
+{
+    if (this != &rhv) {
+        clear();
+        for (const_iterator it = rhv.begin(); it != rhv.end(); ++it) {
+            push_back(*it);
+        }
+    }
+    return *this;
+}
+
+template <typename T>
+typename RankedList<T>::reference
+RankedList<T>::at(const size_type index)
+{
+    assert(index < size_);
+    return findByRank(index + 1)->data_;
+}
+
+template <typename T>
+typename RankedList<T>::const_reference
+RankedList<T>::at(const size_type index) const
+{
+    assert(index < size_);
+    return findByRank(index + 1)->data_;
+}
+
+template <typename T>
+typename RankedList<T>::iterator
+RankedList<T>::iterator_at(const size_type index)
+{
+    return iterator(findByRank(index + 1));
+}
+
+template <typename T>
+typename RankedList<T>::const_iterator
+RankedList<T>::iterator_at(const size_type index) const
+{
+    return const_iterator(findByRank(index + 1));
+}
+
+template <typename T>
+typename RankedList<T>::size_type
+RankedList<T>::index_of(const_iterator position) const
+{
+    return rankOf(position.getPtr()) - 1;
+}
+
+template <typename T>
+typename RankedList<T>::difference_type
+RankedList<T>::distance(const_iterator first, const_iterator last) const
+{
+    return static_cast<difference_type>(index_of(last)) - static_cast<difference_type>(index_of(first));
+}
+
+template <typename T>
+typename RankedList<T>::iterator
+RankedList<T>::insert(iterator position, const_reference value)
+{
+    Node* newNode = new Node(value, randomHeight());
+    link(newNode, position.getPtr());
+    return iterator(newNode);
+}
+
+template <typename T>
+typename RankedList<T>::iterator
+RankedList<T>::erase(iterator position)
+{
+    Node* ptr = position.getPtr();
+    Node* nextNode = ptr->next_;
+    unlink(ptr);
+    delete ptr;
+    return iterator(nextNode);
+}
+
+template <typename T>
+void
+RankedList<T>::push_back(const_reference value)
+{
+    insert(end(), value);
+}
+
+template <typename T>
+void
+RankedList<T>::push_front(const_reference value)
+{
+    insert(begin(), value);
+}
+
+template <typename T>
+void
+RankedList<T>::pop_back()
+{
+    if (empty()) return;
+    erase(iterator(head_->previous_));
+}
+
+template <typename T>
+void
+RankedList<T>::pop_front()
+{
+    if (empty()) return;
+    erase(begin());
+}
+
+template <typename T>
+typename RankedList<T>::reference
+RankedList<T>::front()
+{
+    return head_->next_->data_;
+}
+
+template <typename T>
+typename RankedList<T>::const_reference
+RankedList<T>::front() const
+{
+    return head_->next_->data_;
+}
+
+template <typename T>
+typename RankedList<T>::reference
+RankedList<T>::back()
+{
+    return head_->previous_->data_;
+}
+
+template <typename T>
+typename RankedList<T>::const_reference
+RankedList<T>::back() const
+{
+    return head_->previous_->data_;
+}
+
+template <typename T>
+void
+RankedList<T>::swap(RankedList<T>& rhv)
+{
+    Node* head = head_;
+    head_ = rhv.head_;
+    rhv.head_ = head;
+
+    const size_type size = size_;
+    size_ = rhv.size_;
+    rhv.size_ = size;
+}
+
+template <typename T>
+void
+RankedList<T>::splice(iterator position, RankedList<T>& rhv, iterator index)
+{
+    Node* posNode   = position.getPtr();
+    Node* nodeIndex = index.getPtr();
+
+    if (nodeIndex == posNode || nodeIndex->next_ == posNode) {
+        return;
+    }
+
+    rhv.unlink(nodeIndex);
+    link(nodeIndex, posNode);
+}
+
+/// Cuts [first, last) out of rhv once per level and links the piece in
+/// front of position the same way, so the cost does not grow with the
+/// length of the range. Piece ranks count from 1 at first.
+template <typename T>
+void
+RankedList<T>::splice(iterator position, RankedList<T>& rhv, iterator first, iterator last)
+{
+    Node* firstNode = first.getPtr();
+    Node* lastNode  = last.getPtr();
+    Node* posNode   = position.getPtr();
+    if (firstNode == lastNode || posNode == firstNode || posNode == lastNode) {
+        return;
+    }
+
+    const size_type firstRank = rhv.rankOf(firstNode);
+    const size_type count = rhv.rankOf(lastNode) - firstRank;
+    Node* update[MAX_LEVEL];
+    size_type updateRank[MAX_LEVEL];
+    Node* tail[MAX_LEVEL];
+    size_type tailRank[MAX_LEVEL];
+    Node* head[MAX_LEVEL];
+    size_type headRank[MAX_LEVEL];
+    rhv.findPredecessors(firstRank - 1, update, updateRank);
+    rhv.findPredecessors(firstRank + count - 1, tail, tailRank);
+
+    for (size_type level = 1; level < MAX_LEVEL; ++level) {
+        Link& before = update[level]->levels_[level - 1];
+        if (tail[level] != update[level]) {
+            const Link& after = tail[level]->levels_[level - 1];
+            head[level] = before.next_;
+            headRank[level] = updateRank[level] + before.width_ + 1 - firstRank;
+            before.width_ = tailRank[level] + after.width_ - updateRank[level] - count;
+            before.next_  = after.next_;
+            tailRank[level] = tailRank[level] + 1 - firstRank;
+        } else {
+            head[level] = NULL;
+            before.width_ -= count;
+        }
+    }
+
+    Node* lastInRange = lastNode->previous_;
+    firstNode->previous_->next_ = lastNode;
+    lastNode->previous_ = firstNode->previous_;
+    rhv.size_ -= count;
+
+    const size_type rank = rankOf(posNode);
+    findPredecessors(rank - 1, update, updateRank);
+    for (size_type level = 1; level < MAX_LEVEL; ++level) {
+        Link& before = update[level]->levels_[level - 1];
+        if (head[level] != NULL) {
+            Link& after = tail[level]->levels_[level - 1];
+            after.next_  = before.next_;
+            after.width_ = updateRank[level] + before.width_ + count + 1 - rank - tailRank[level];
+            before.next_  = head[level];
+            before.width_ = rank - 1 - updateRank[level] + headRank[level];
+        } else {
+            before.width_ += count;
+        }
+    }
+
+    firstNode->previous_ = posNode->previous_;
+    lastInRange->next_ = posNode;
+    posNode->previous_->next_ = firstNode;
+    posNode->previous_ = lastInRange;
+    size_ += count;
+}
+
+template <typename T>
+typename RankedList<T>::size_type
+RankedList<T>::size() const
+{
+    return size_;
+}
+
+template <typename T>
+bool
+RankedList<T>::empty() const
+{
+    return 0 == size_;
+}
+
+template <typename T>
+void
+RankedList<T>::clear()
+{
+    Node* node = head_->next_;
+    while (node != head_) {
+        Node* next = node->next_;
+        delete node;
+        node = next;
+    }
+
+    head_->next_ = head_->previous_ = head_;
+    for (size_type level = 1; level < MAX_LEVEL; ++level) {
+        head_->levels_[level - 1].next_  = NULL;
+        head_->levels_[level - 1].width_ = 1;
+    }
+    size_ = 0;
+}
+
+template <typename T>
+typename RankedList<T>::const_iterator
+RankedList<T>::begin() const
+{
+    return const_iterator(head_->next_);
+}
+
+template <typename T>
+typename RankedList<T>::const_iterator
+RankedList<T>::end() const
+{
+    return const_iterator(head_);
+}
+
+template <typename T>
+typename RankedList<T>::iterator
+RankedList<T>::begin()
+{
+    return iterator(head_->next_);
+}
+
+template <typename T>
+typename RankedList<T>::iterator
+RankedList<T>::end()
+{
+    return iterator(head_);
+}
+
+/// Ranks count level-0 hops from head_: the first element has rank 1 and
+/// end() has rank size() + 1. A NULL link at some level leads to end().
+template <typename T>
+typename RankedList<T>::size_type
+RankedList<T>::rankOf(const Node* node) const
+{
+    size_type distance = 0;
+    while (node != head_) {
+        if (node->height_ > 1) {
+            const Link& top = node->levels_[node->height_ - 2];
+            distance += top.width_;
+            if (NULL == top.next_) break;
+            node = top.next_;
+        } else {
+            node = node->next_;
+            ++distance;
+        }
+    }
+    return size_ + 1 - distance;
+}
+
+template <typename T>
+typename RankedList<T>::Node*
+RankedList<T>::findByRank(const size_type rank) const
+{
+    if (0 == rank || rank > size_) return head_;
+
+    Node* node = head_;
+    size_type traversed = 0;
+    for (size_type level = MAX_LEVEL - 1; level > 0; --level) {
+        while (node->levels_[level - 1].next_ != NULL
+               && traversed + node->levels_[level - 1].width_ <= rank) {
+            traversed += node->levels_[level - 1].width_;
+            node = node->levels_[level - 1].next_;
+        }
+    }
+    while (traversed < rank) {
+        node = node->next_;
+        ++traversed;
+    }
+    return node;
+}
+
+template <typename T>
+void
+RankedList<T>::findPredecessors(const size_type rank, Node** update, size_type* updateRank) const
+{
+    Node* node = head_;
+    size_type traversed = 0;
+    for (size_type level = MAX_LEVEL - 1; level > 0; --level) {
+        while (node->levels_[level - 1].next_ != NULL
+               && traversed + node->levels_[level - 1].width_ <= rank) {
+            traversed += node->levels_[level - 1].width_;
+            node = node->levels_[level - 1].next_;
+        }
+        update[level] = node;
+        updateRank[level] = traversed;
+    }
+}
+
+template <typename T>
+void
+RankedList<T>::link(Node* node, Node* position)
+{
+    const size_type rank = rankOf(position);
+    Node* update[MAX_LEVEL];
+    size_type updateRank[MAX_LEVEL];
+    findPredecessors(rank - 1, update, updateRank);
+    link(node, position, rank, update, updateRank);
+}
+
+/// Takes the predecessors findPredecessors(rank - 1) would report, so a
+/// caller that already descended to position does not descend again.
+template <typename T>
+void
+RankedList<T>::link(Node* node, Node* position, const size_type rank,
+                    Node* const* update, const size_type* updateRank)
+{
+    for (size_type level = 1; level < MAX_LEVEL; ++level) {
+        Link& before = update[level]->levels_[level - 1];
+        if (level < node->height_) {
+            Link& own = node->levels_[level - 1];
+            own.next_  = before.next_;
+            own.width_ = updateRank[level] + before.width_ + 1 - rank;
+            before.next_  = node;
+            before.width_ = rank - updateRank[level];
+        } else {
+            ++before.width_;
+        }
+    }
+
+    node->next_ = position;
+    node->previous_ = position->previous_;
+    position->previous_->next_ = node;
+    position->previous_ = node;
+    ++size_;
+}
+
+template <typename T>
+void
+RankedList<T>::unlink(Node* node)
+{
+    const size_type rank = rankOf(node);
+    Node* update[MAX_LEVEL];
+    size_type updateRank[MAX_LEVEL];
+    findPredecessors(rank - 1, update, updateRank);
+
+    for (size_type level = 1; level < MAX_LEVEL; ++level) {
+        Link& before = update[level]->levels_[level - 1];
+        if (before.next_ == node) {
+            const Link& own = node->levels_[level - 1];
+            before.next_  = own.next_;
+            before.width_ += own.width_ - 1;
+        } else {
+            --before.width_;
+        }
+    }
+
+    node->previous_->next_ = node->next_;
+    node->next_->previous_ = node->previous_;
+    --size_;
+}
+
+/// p = 1/4 per level
+template <typename T>
+typename RankedList<T>::size_type
+RankedList<T>::randomHeight()
+{
+    size_type height = 1;
+    while (height < MAX_LEVEL) {
+        seed_ ^= seed_ << 13;
+        seed_ ^= seed_ >> 17;
+        seed_ ^= seed_ << 5;
+        if (0 != (seed_ & 3)) break;
+        ++height;
+    }
+    return height;
+}
+
+///==================================CONST_ITERATOR===============================================================
+template <typename T>
+RankedList<T>::const_iterator::const_iterator()
+    : ptr_(NULL)
+{}
+
+template <typename T>
+RankedList<T>::const_iterator::const_iterator(const const_iterator& rhv)
+    : ptr_(rhv.ptr_)
+{}
+
+template <typename T>
+RankedList<T>::const_iterator::const_iterator(Node* node)
+    : ptr_(node)
+{}
+
+template <typename T>
+RankedList<T>::const_iterator::~const_iterator()
+{
+    ptr_ = NULL;
+}
+
+template <typename T>
+typename RankedList<T>::const_iterator&
+RankedList<T>::const_iterator::operator=(const const_iterator& rhv)
+{
+    if (this != &rhv) {
+        ptr_ = rhv.ptr_;
+    }
+    return *this;
+}
+
+template <typename T>
+typename RankedList<T>::const_reference
+RankedList<T>::const_iterator::operator*() const
+{
+    return ptr_->data_;
+}
+
+template <typename T>
+typename RankedList<T>::const_pointer
+RankedList<T>::const_iterator::operator->() const
+{
+    return &ptr_->data_;
+}
+
+template <typename T>
+typename RankedList<T>::const_iterator&
+RankedList<T>::const_iterator::operator++()
+{
+    ptr_ = ptr_->next_;
+    return *this;
+}
+
+template <typename T>
+typename RankedList<T>::const_iterator
+RankedList<T>::const_iterator::operator++(int)
+{
+    const_iterator temp(*this);
+    ++(*this);
+    return temp;
+}
+
+template <typename T>
+typename RankedList<T>::const_iterator&
+RankedList<T>::const_iterator::operator--()
+{
+    ptr_ = ptr_->previous_;
+    return *this;
+}
+
+template <typename T>
+typename RankedList<T>::const_iterator
+RankedList<T>::const_iterator::operator--(int)
+{
+    const_iterator temp(*this);
+    --(*this);
+    return temp;
+}
+
+template <typename T>
+bool
+RankedList<T>::const_iterator::operator==(const const_iterator& rhv) const
+{
+    return ptr_ == rhv.ptr_;
+}
+
+template <typename T>
+bool
+RankedList<T>::const_iterator::operator!=(const const_iterator& rhv) const
+{
+    return !(*this == rhv);
+}
+
+template <typename T>
+typename RankedList<T>::Node*
+RankedList<T>::const_iterator::getPtr() const
+{
+    return ptr_;
+}
+
+///===================================ITERATOR===============================================================
+template <typename T>
+RankedList<T>::iterator::iterator()
+    : const_iterator()
+{}
+
+template <typename T>
+RankedList<T>::iterator::iterator(const iterator& rhv)
+    : const_iterator(rhv.getPtr())
+{}
+
+template <typename T>
+RankedList<T>::iterator::iterator(Node* node)
+    : const_iterator(node)
+{}
+
+template <typename T>
+RankedList<T>::iterator::~iterator()
+{}
+
+template <typename T>
+typename RankedList<T>::iterator&
+RankedList<T>::iterator::operator=(const iterator& rhv)
+{
+    const_iterator::operator=(rhv);
+    return *this;
+}
+
+template <typename T>
+typename RankedList<T>::reference
+RankedList<T>::iterator::operator*() const
+{
+    return this->getPtr()->data_;
+}
+
+template <typename T>
+typename RankedList<T>::pointer
+RankedList<T>::iterator::operator->() const
+{
+    return &this->getPtr()->data_;
+}
@@ -0,0 +1,316 @@
+#include "../headers/RcuList.hpp"
+#include "../headers/Atomic.hpp"
+#include <cstddef>
+
+template <typename T>
+RcuList<T>::RcuList()
+    : head_(new Node())
+    , tail_(head_)
+    , size_(0)
+    , reclaimer_()
+{
+    ::pthread_mutex_init(&writer_, NULL);
+}
+
+/// Readers must be gone; retired nodes are freed by the reclaimer.
+template <typename T>
+RcuList<T>::~RcuList()
+{
+    while (head_ != NULL) {
+        Node* next = head_->next_;
+        delete head_;
+        head_ = next;
+    }
+    ::pthread_mutex_destroy(&writer_);
+}
+
+template <typename T>
+void
+RcuList<T>::push_front(const_reference value)
+{
+    lockWriter();
+    publish(head_, new Node(value, head_->next_));
+    unlockWriter();
+}
+
+template <typename T>
+void
+RcuList<T>::push_back(const_reference value)
+{
+    lockWriter();
+    publish(tail_, new Node(value));
+    unlockWriter();
+}
+
+/// Inserts before the first element for which before() holds, or at the back.
+template <typename T>
+template <typename Predicate>
+void
+RcuList<T>::insert(Predicate before, const_reference value)
+{
+    lockWriter();
+    Node* previous = head_;
+    while (previous->next_ != NULL && !before(previous->next_->data_)) {
+        previous = previous->next_;
+    }
+    publish(previous, new Node(value, previous->next_));
+    unlockWriter();
+}
+
+template <typename T>
+bool
+RcuList<T>::erase(const_reference value)
+{
+    return erase_if(EqualTo(value));
+}
+
+/// Erases the first element for which predicate() holds. Readers standing
+/// on it still find its successor until the grace period ends.
+template <typename T>
+template <typename Predicate>
+bool
+RcuList<T>::erase_if(Predicate predicate)
+{
+    lockWriter();
+    Node* previous = head_;
+    while (previous->next_ != NULL && !predicate(previous->next_->data_)) {
+        previous = previous->next_;
+    }
+    const bool found = previous->next_ != NULL;
+    if (found) {
+        Node* node = previous->next_;
+        Atomic::store(&previous->next_, node->next_);
+        Atomic::fetchAdd(&size_, static_cast<size_type>(-1));
+        retire(previous, node);
+    }
+    unlockWriter();
+    return found;
+}
+
+/// Copy-update: the first matching element is replaced by a new node, so a
+/// reader sees either the old value or the new one, never a torn write.
+template <typename T>
+template <typename Predicate>
+bool
+RcuList<T>::replace_if(Predicate predicate, const_reference value)
+{
+    lockWriter();
+    Node* previous = head_;
+    while (previous->next_ != NULL && !predicate(previous->next_->data_)) {
+        previous = previous->next_;
+    }
+    const bool found = previous->next_ != NULL;
+    if (found) {
+        Node* node = previous->next_;
+        Node* replacement = new Node(value, node->next_);
+        Atomic::store(&previous->next_, replacement);
+        if (tail_ == node) {
+            tail_ = replacement;
+        }
+        retire(previous, node);
+    }
+    unlockWriter();
+    return found;
+}
+
+/// Detaches the whole chain with one store; readers already on it finish
+/// their walk on the old nodes.
+template <typename T>
+void
+RcuList<T>::clear()
+{
+    lockWriter();
+    Node* chain = head_->next_;
+    Atomic::store(&head_->next_, static_cast<Node*>(NULL));
+    tail_ = head_;
+    Atomic::store(&size_, static_cast<size_type>(0));
+    {
+        Guard guard(reclaimer_);
+        while (chain != NULL) {
+            Node* next = chain->next_;
+            reclaimer_.retire(chain);
+            chain = next;
+        }
+    }
+    unlockWriter();
+}
+
+/// Waits for a grace period, after which every node unlinked so far has
+/// been reclaimed. Must not be called inside a read-side section.
+template <typename T>
+void
+RcuList<T>::synchronize()
+{
+    reclaimer_.synchronize();
+}
+
+template <typename T>
+typename RcuList<T>::size_type
+RcuList<T>::size() const
+{
+    return Atomic::load(&size_);
+}
+
+template <typename T>
+bool
+RcuList<T>::empty() const
+{
+    return 0 == size();
+}
+
+template <typename T>
+typename RcuList<T>::const_iterator
+RcuList<T>::begin() const
+{
+    return const_iterator(Atomic::load(&head_->next_));
+}
+
+template <typename T>
+typename RcuList<T>::const_iterator
+RcuList<T>::end() const
+{
+    return const_iterator(NULL);
+}
+
+template <typename T>
+void
+RcuList<T>::lockWriter()
+{
+    ::pthread_mutex_lock(&writer_);
+}
+
+template <typename T>
+void
+RcuList<T>::unlockWriter()
+{
+    ::pthread_mutex_unlock(&writer_);
+}
+
+/// node->next_ is set already; the release store makes node and its payload
+/// visible before it becomes reachable.
+template <typename T>
+void
+RcuList<T>::publish(Node* previous, Node* node)
+{
+    Atomic::store(&previous->next_, node);
+    if (tail_ == previous) {
+        tail_ = node;
+    }
+    Atomic::fetchAdd(&size_, static_cast<size_type>(1));
+}
+
+/// node is already unlinked from previous.
+template <typename T>
+void
+RcuList<T>::retire(Node* previous, Node* node)
+{
+    if (tail_ == node) {
+        tail_ = previous;
+    }
+    Guard guard(reclaimer_);
+    reclaimer_.retire(node);
+    reclaimer_.collect();
+}
+
+///======================================READER==============================================
+
+template <typename T>
+RcuList<T>::Reader::Reader(const RcuList<T>& list)
+    : participant_(list.reclaimer_)
+{}
+
+template <typename T>
+RcuList<T>::Reader::~Reader()
+{}
+
+template <typename T>
+void
+RcuList<T>::Reader::lock()
+{
+    participant_.enter();
+}
+
+template <typename T>
+void
+RcuList<T>::Reader::unlock()
+{
+    participant_.leave();
+}
+
+///======================================CONST_ITERATOR======================================
+
+template <typename T>
+RcuList<T>::const_iterator::const_iterator()
+    : ptr_(NULL)
+{}
+
+template <typename T>
+RcuList<T>::const_iterator::const_iterator(const const_iterator& rhv)
+    : ptr_(rhv.ptr_)
+{}
+
+template <typename T>
+RcuList<T>::const_iterator::const_iterator(Node* node)
+    : ptr_(node)
+{}
+
+template <typename T>
+RcuList<T>::const_iterator::~const_iterator()
+{
+    ptr_ = NULL;
+}
+
+template <typename T>
+typename RcuList<T>::const_iterator&
+RcuList<T>::const_iterator::operator=(const const_iterator& rhv)
+{
+    if (this != &rhv) {
+        ptr_ = rhv.ptr_;
+    }
+    return *this;
+}
+
+template <typename T>
+typename RcuList<T>::const_reference
+RcuList<T>::const_iterator::operator*() const
+{
+    return ptr_->data_;
+}
+
+template <typename T>
+const T*
+RcuList<T>::const_iterator::operator->() const
+{
+    return &ptr_->data_;
+}
+
+template <typename T>
+typename RcuList<T>::const_iterator&
+RcuList<T>::const_iterator::operator++()
+{
+    ptr_ = Atomic::load(&ptr_->next_);
+    return *this;
+}
+
+template <typename T>
+typename RcuList<T>::const_iterator
+RcuList<T>::const_iterator::operator++(int)
+{
+    const_iterator temp(*this);
+    ++(*this);
+    return temp;
+}
+
+template <typename T>
+bool
+RcuList<T>::const_iterator::operator==(const const_iterator& rhv) const
+{
+    return ptr_ == rhv.ptr_;
+}
+
+template <typename T>
+bool
+RcuList<T>::const_iterator::operator!=(const const_iterator& rhv) const
+{
+    return !(*this == rhv);
+}
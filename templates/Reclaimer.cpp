@@ -0,0 +1,148 @@
+#include "../headers/Reclaimer.hpp"
+#include <cassert>
+#include <cstddef>
+
+inline
+Reclaimer::Reclaimer(const size_type batch)
+    : jobs_()
+    , busy_(0)
+    , batch_(batch)
+    , stopping_(false)
+{
+    assert(batch > 0);
+    ::pthread_mutex_init(&mutex_, NULL);
+    ::pthread_cond_init(&wake_, NULL);
+    ::pthread_cond_init(&idle_, NULL);
+    ::pthread_create(&thread_, NULL, start, this);
+}
+
+/// Frees whatever is still queued, then joins the thread.
+inline
+Reclaimer::~Reclaimer()
+{
+    ::pthread_mutex_lock(&mutex_);
+    stopping_ = true;
+    ::pthread_cond_signal(&wake_);
+    ::pthread_mutex_unlock(&mutex_);
+
+    ::pthread_join(thread_, NULL);
+    ::pthread_cond_destroy(&idle_);
+    ::pthread_cond_destroy(&wake_);
+    ::pthread_mutex_destroy(&mutex_);
+}
+
+/// Process-wide reclaimer, started on first use.
+inline
+Reclaimer&
+Reclaimer::instance()
+{
+    static Reclaimer reclaimer;
+    return reclaimer;
+}
+
+inline
+void
+Reclaimer::retire(void* chain, Destroy destroy)
+{
+    assert(destroy != NULL);
+    if (NULL == chain) {
+        return;
+    }
+    ::pthread_mutex_lock(&mutex_);
+    jobs_.push_back(Job(chain, destroy));
+    ::pthread_cond_signal(&wake_);
+    ::pthread_mutex_unlock(&mutex_);
+}
+
+/// Blocks until every chain retired so far is freed.
+inline
+void
+Reclaimer::drain()
+{
+    ::pthread_mutex_lock(&mutex_);
+    while (!jobs_.empty() || busy_ != 0) {
+        ::pthread_cond_wait(&idle_, &mutex_);
+    }
+    ::pthread_mutex_unlock(&mutex_);
+}
+
+/// Chains not yet completely freed.
+inline
+Reclaimer::size_type
+Reclaimer::pending() const
+{
+    ::pthread_mutex_lock(&mutex_);
+    const size_type count = jobs_.size() + busy_;
+    ::pthread_mutex_unlock(&mutex_);
+    return count;
+}
+
+/// One batch per turn; an unfinished chain goes to the back of the queue.
+inline
+void
+Reclaimer::work()
+{
+    ::pthread_mutex_lock(&mutex_);
+    for (;;) {
+        while (jobs_.empty() && !stopping_) {
+            ::pthread_cond_wait(&wake_, &mutex_);
+        }
+        if (jobs_.empty()) {
+            break;
+        }
+        Job job = jobs_.front();
+        jobs_.pop_front();
+        ++busy_;
+        ::pthread_mutex_unlock(&mutex_);
+
+        job.chain_ = job.destroy_(job.chain_, batch_);
+
+        ::pthread_mutex_lock(&mutex_);
+        --busy_;
+        if (job.chain_ != NULL) {
+            jobs_.push_back(job);
+        } else if (jobs_.empty() && 0 == busy_) {
+            ::pthread_cond_broadcast(&idle_);
+        }
+    }
+    ::pthread_mutex_unlock(&mutex_);
+}
+
+inline
+void*
+Reclaimer::start(void* argument)
+{
+    static_cast<Reclaimer*>(argument)->work();
+    return NULL;
+}
+
+///======================================LIST================================================
+
+/// Detaches every node in O(1) and leaves freeing them to reclaimer. The
+/// list is empty afterwards and can be reused or destroyed at no cost.
+template <typename T>
+void
+List<T>::release_async(Reclaimer& reclaimer)
+{
+    reclaimer.retire(unlink(begin_, end_, size_), destroyBatch);
+}
+
+template <typename T>
+void
+List<T>::release_async()
+{
+    release_async(Reclaimer::instance());
+}
+
+template <typename T>
+void*
+List<T>::destroyBatch(void* chain, const size_type limit)
+{
+    Node* node = static_cast<Node*>(chain);
+    for (size_type count = 0; node != NULL && count < limit; ++count) {
+        Node* next = node->next_;
+        delete node;
+        node = next;
+    }
+    return node;
+}
@@ -0,0 +1,275 @@
+#include "../headers/ShardedList.hpp"
+#include "../headers/Atomic.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <unistd.h>
+
+template <typename T>
+typename ShardedList<T>::size_type ShardedList<T>::threads_ = 0;
+
+template <typename T>
+std::vector<typename ShardedList<T>::size_type>* ShardedList<T>::freeIndices_ = NULL;
+
+template <typename T>
+pthread_mutex_t ShardedList<T>::indices_ = PTHREAD_MUTEX_INITIALIZER;
+
+template <typename T>
+pthread_once_t ShardedList<T>::once_ = PTHREAD_ONCE_INIT;
+
+template <typename T>
+pthread_key_t ShardedList<T>::key_;
+
+/// Zero shards means one per online CPU.
+template <typename T>
+ShardedList<T>::ShardedList(const size_type shards)
+    : shards_(NULL)
+    , shardCount_(shards)
+{
+    if (0 == shardCount_) {
+        const long processors = ::sysconf(_SC_NPROCESSORS_ONLN);
+        shardCount_ = processors > 0 ? static_cast<size_type>(processors) : 1;
+    }
+    shards_ = new Shard[shardCount_];
+}
+
+template <typename T>
+ShardedList<T>::~ShardedList()
+{
+    delete [] shards_;
+}
+
+template <typename T>
+void
+ShardedList<T>::push_back(const_reference value)
+{
+    Shard& shard = shards_[threadIndex() % shardCount_];
+    ::pthread_mutex_lock(&shard.mutex_);
+    shard.list_.push_back(value);
+    Atomic::storeRelaxed(&shard.count_, shard.count_ + 1);
+    ::pthread_mutex_unlock(&shard.mutex_);
+}
+
+/// Moves every shard to the back of list, shard by shard.
+template <typename T>
+typename ShardedList<T>::size_type
+ShardedList<T>::drain_into(List<T>& list)
+{
+    size_type moved = 0;
+    for (size_type i = 0; i < shardCount_; ++i) {
+        Shard& shard = shards_[i];
+        ::pthread_mutex_lock(&shard.mutex_);
+        moved += shard.count_;
+        list.splice(list.end(), shard.list_);
+        Atomic::storeRelaxed(&shard.count_, static_cast<size_type>(0));
+        ::pthread_mutex_unlock(&shard.mutex_);
+    }
+    return moved;
+}
+
+template <typename T>
+void
+ShardedList<T>::clear()
+{
+    for (size_type i = 0; i < shardCount_; ++i) {
+        Shard& shard = shards_[i];
+        ::pthread_mutex_lock(&shard.mutex_);
+        shard.list_.clear();
+        Atomic::storeRelaxed(&shard.count_, static_cast<size_type>(0));
+        ::pthread_mutex_unlock(&shard.mutex_);
+    }
+}
+
+/// Sums the shard counts without locking; exact once appenders are quiet.
+template <typename T>
+typename ShardedList<T>::size_type
+ShardedList<T>::size() const
+{
+    size_type total = 0;
+    for (size_type i = 0; i < shardCount_; ++i) {
+        total += Atomic::loadRelaxed(&shards_[i].count_);
+    }
+    return total;
+}
+
+template <typename T>
+bool
+ShardedList<T>::empty() const
+{
+    for (size_type i = 0; i < shardCount_; ++i) {
+        if (Atomic::loadRelaxed(&shards_[i].count_) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename T>
+typename ShardedList<T>::size_type
+ShardedList<T>::shards() const
+{
+    return shardCount_;
+}
+
+template <typename T>
+typename ShardedList<T>::const_iterator
+ShardedList<T>::begin() const
+{
+    return const_iterator(this, 0);
+}
+
+template <typename T>
+typename ShardedList<T>::const_iterator
+ShardedList<T>::end() const
+{
+    return const_iterator(this, shardCount_);
+}
+
+/// A thread's number, taken on its first append: the lowest one handed
+/// back by an exited thread, or a new one.
+template <typename T>
+typename ShardedList<T>::size_type
+ShardedList<T>::threadIndex()
+{
+    static __thread size_type index = 0;   ///< number + 1, 0 until taken
+    if (0 == index) {
+        ::pthread_once(&once_, createKey);
+        ::pthread_mutex_lock(&indices_);
+        if (freeIndices_ != NULL && !freeIndices_->empty()) {
+            std::pop_heap(freeIndices_->begin(), freeIndices_->end(), std::greater<size_type>());
+            index = freeIndices_->back() + 1;
+            freeIndices_->pop_back();
+        } else {
+            index = ++threads_;
+        }
+        ::pthread_mutex_unlock(&indices_);
+        ::pthread_setspecific(key_, reinterpret_cast<void*>(index));
+    }
+    return index - 1;
+}
+
+/// Thread exit: the number goes back for the next new thread.
+template <typename T>
+void
+ShardedList<T>::releaseIndex(void* index)
+{
+    ::pthread_mutex_lock(&indices_);
+    if (NULL == freeIndices_) {
+        freeIndices_ = new std::vector<size_type>();
+    }
+    freeIndices_->push_back(reinterpret_cast<size_type>(index) - 1);
+    std::push_heap(freeIndices_->begin(), freeIndices_->end(), std::greater<size_type>());
+    ::pthread_mutex_unlock(&indices_);
+}
+
+template <typename T>
+void
+ShardedList<T>::createKey()
+{
+    ::pthread_key_create(&key_, releaseIndex);
+}
+
+///======================================CONST_ITERATOR======================================
+
+template <typename T>
+ShardedList<T>::const_iterator::const_iterator()
+    : owner_(NULL)
+    , shard_(0)
+    , position_()
+{}
+
+template <typename T>
+ShardedList<T>::const_iterator::const_iterator(const const_iterator& rhv)
+    : owner_(rhv.owner_)
+    , shard_(rhv.shard_)
+    , position_(rhv.position_)
+{}
+
+template <typename T>
+ShardedList<T>::const_iterator::const_iterator(const ShardedList<T>* owner, size_type shard)
+    : owner_(owner)
+    , shard_(shard)
+    , position_()
+{
+    if (shard_ < owner_->shardCount_) {
+        position_ = owner_->shards_[shard_].list_.begin();
+        skipEmpty();
+    }
+}
+
+template <typename T>
+ShardedList<T>::const_iterator::~const_iterator()
+{
+    owner_ = NULL;
+}
+
+template <typename T>
+typename ShardedList<T>::const_iterator&
+ShardedList<T>::const_iterator::operator=(const const_iterator& rhv)
+{
+    if (this != &rhv) {
+        owner_ = rhv.owner_;
+        shard_ = rhv.shard_;
+        position_ = rhv.position_;
+    }
+    return *this;
+}
+
+template <typename T>
+typename ShardedList<T>::const_reference
+ShardedList<T>::const_iterator::operator*() const
+{
+    return *position_;
+}
+
+template <typename T>
+const T*
+ShardedList<T>::const_iterator::operator->() const
+{
+    return &*position_;
+}
+
+template <typename T>
+typename ShardedList<T>::const_iterator&
+ShardedList<T>::const_iterator::operator++()
+{
+    ++position_;
+    skipEmpty();
+    return *this;
+}
+
+template <typename T>
+typename ShardedList<T>::const_iterator
+ShardedList<T>::const_iterator::operator++(int)
+{
+    const_iterator temp(*this);
+    ++(*this);
+    return temp;
+}
+
+template <typename T>
+bool
+ShardedList<T>::const_iterator::operator==(const const_iterator& rhv) const
+{
+    return shard_ == rhv.shard_
+        && (shard_ == owner_->shardCount_ || position_ == rhv.position_);
+}
+
+template <typename T>
+bool
+ShardedList<T>::const_iterator::operator!=(const const_iterator& rhv) const
+{
+    return !(*this == rhv);
+}
+
+/// Moves on to the next non-empty shard once the current one is used up.
+template <typename T>
+void
+ShardedList<T>::const_iterator::skipEmpty()
+{
+    while (shard_ < owner_->shardCount_ && position_ == owner_->shards_[shard_].list_.end()) {
+        if (++shard_ < owner_->shardCount_) {
+            position_ = owner_->shards_[shard_].list_.begin();
+        }
+    }
+}
@@ -0,0 +1,172 @@
+#include "../headers/SharedList.hpp"
+#include "../headers/Atomic.hpp"
+#include <cstddef>
+
+template <typename T>
+SharedList<T>::SharedList()
+    : block_(new Block())
+{}
+
+template <typename T>
+SharedList<T>::SharedList(const List<T>& list)
+    : block_(new Block(list))
+{}
+
+template <typename T>
+SharedList<T>::SharedList(const SharedList<T>& rhv)
+    : block_(rhv.block_)
+{
+    share(block_);
+}
+
+template <typename T>
+SharedList<T>::~SharedList()
+{
+    release(block_);
+}
+
+template <typename T>
+SharedList<T>&
+SharedList<T>::operator=(const SharedList<T>& rhv)
+{
+    if (block_ != rhv.block_) {
+        share(rhv.block_);
+        release(block_);
+        block_ = rhv.block_;
+    }
+    return *this;
+}
+
+template <typename T>
+const List<T>&
+SharedList<T>::list() const
+{
+    return block_->list_;
+}
+
+/// The reference stays private only until this handle is copied again.
+template <typename T>
+List<T>&
+SharedList<T>::mutate()
+{
+    detach();
+    return block_->list_;
+}
+
+template <typename T>
+void
+SharedList<T>::push_back(const_reference value)
+{
+    mutate().push_back(value);
+}
+
+template <typename T>
+void
+SharedList<T>::push_front(const_reference value)
+{
+    mutate().push_front(value);
+}
+
+template <typename T>
+void
+SharedList<T>::pop_back()
+{
+    if (empty()) return;
+    mutate().pop_back();
+}
+
+template <typename T>
+void
+SharedList<T>::pop_front()
+{
+    if (empty()) return;
+    mutate().pop_front();
+}
+
+template <typename T>
+void
+SharedList<T>::clear()
+{
+    if (use_count() > 1) {
+        release(block_);
+        block_ = new Block();
+        return;
+    }
+    block_->list_.clear();
+}
+
+template <typename T>
+typename SharedList<T>::const_reference
+SharedList<T>::front() const
+{
+    return block_->list_.front();
+}
+
+template <typename T>
+typename SharedList<T>::const_reference
+SharedList<T>::back() const
+{
+    return block_->list_.back();
+}
+
+template <typename T>
+typename SharedList<T>::size_type
+SharedList<T>::size() const
+{
+    return block_->list_.size();
+}
+
+template <typename T>
+bool
+SharedList<T>::empty() const
+{
+    return block_->list_.empty();
+}
+
+template <typename T>
+typename SharedList<T>::size_type
+SharedList<T>::use_count() const
+{
+    return Atomic::load(&block_->references_);
+}
+
+template <typename T>
+typename SharedList<T>::const_iterator
+SharedList<T>::begin() const
+{
+    return block_->list_.begin();
+}
+
+template <typename T>
+typename SharedList<T>::const_iterator
+SharedList<T>::end() const
+{
+    return block_->list_.end();
+}
+
+template <typename T>
+void
+SharedList<T>::detach()
+{
+    if (1 == use_count()) return;
+
+    Block* copy = new Block(block_->list_);
+    release(block_);
+    block_ = copy;
+}
+
+template <typename T>
+void
+SharedList<T>::share(Block* block)
+{
+    Atomic::fetchAdd(&block->references_, static_cast<size_type>(1));
+}
+
+template <typename T>
+void
+SharedList<T>::release(Block* block)
+{
+    if (1 == Atomic::fetchAdd(&block->references_, static_cast<size_type>(-1))) {
+        delete block;
+    }
+}
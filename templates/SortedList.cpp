@@ -0,0 +1,206 @@
+#include "../headers/SortedList.hpp"
+#include <cstddef>
+
+template <typename T, typename Compare>
+SortedList<T, Compare>::SortedList(const Compare& comparison)
+    : list_()
+    , comparison_(comparison)
+{}
+
+template <typename T, typename Compare>
+template <typename InputIterator>
+SortedList<T, Compare>::SortedList(InputIterator first, InputIterator last, const Compare& comparison)
+    : list_()
+    , comparison_(comparison)
+{
+    for (InputIterator it = first; it != last; ++it) {
+        insert_sorted(*it);
+    }
+}
+
+/// One descent finds the upper bound, its rank and the per-level predecessors.
+template <typename T, typename Compare>
+typename SortedList<T, Compare>::const_iterator
+SortedList<T, Compare>::insert_sorted(const_reference value)
+{
+    typedef typename RankedList<T>::Link Link;
+    Node* update[RankedList<T>::MAX_LEVEL];
+    size_type updateRank[RankedList<T>::MAX_LEVEL];
+    Node* node = list_.head_;
+    size_type traversed = 0;
+    for (size_type level = RankedList<T>::MAX_LEVEL - 1; level > 0; --level) {
+        const Link* link = &node->levels_[level - 1];
+        while (link->next_ != NULL && !comparison_(value, link->next_->data_)) {
+            traversed += link->width_;
+            node = link->next_;
+            link = &node->levels_[level - 1];
+        }
+        update[level] = node;
+        updateRank[level] = traversed;
+    }
+
+    Node* next = node->next_;
+    while (next != list_.head_ && !comparison_(value, next->data_)) {
+        next = next->next_;
+        ++traversed;
+    }
+
+    Node* newNode = new Node(value, list_.randomHeight());
+    list_.link(newNode, next, traversed + 1, update, updateRank);
+    return const_iterator(newNode);
+}
+
+template <typename T, typename Compare>
+typename SortedList<T, Compare>::const_iterator
+SortedList<T, Compare>::erase(const_iterator position)
+{
+    Node* ptr = position.getPtr();
+    Node* nextNode = ptr->next_;
+    list_.unlink(ptr);
+    delete ptr;
+    return const_iterator(nextNode);
+}
+
+template <typename T, typename Compare>
+typename SortedList<T, Compare>::size_type
+SortedList<T, Compare>::erase(const_reference value)
+{
+    size_type removed = 0;
+    const_iterator it = lower_bound(value);
+    while (it != end() && !comparison_(value, *it)) {
+        it = erase(it);
+        ++removed;
+    }
+    return removed;
+}
+
+template <typename T, typename Compare>
+void
+SortedList<T, Compare>::pop_front()
+{
+    list_.pop_front();
+}
+
+template <typename T, typename Compare>
+void
+SortedList<T, Compare>::pop_back()
+{
+    list_.pop_back();
+}
+
+template <typename T, typename Compare>
+typename SortedList<T, Compare>::const_iterator
+SortedList<T, Compare>::lower_bound(const_reference value) const
+{
+    return const_iterator(bound(value, false));
+}
+
+template <typename T, typename Compare>
+typename SortedList<T, Compare>::const_iterator
+SortedList<T, Compare>::upper_bound(const_reference value) const
+{
+    return const_iterator(bound(value, true));
+}
+
+template <typename T, typename Compare>
+typename SortedList<T, Compare>::const_iterator
+SortedList<T, Compare>::find(const_reference value) const
+{
+    const_iterator it = lower_bound(value);
+    if (it != end() && !comparison_(value, *it)) {
+        return it;
+    }
+    return end();
+}
+
+template <typename T, typename Compare>
+typename SortedList<T, Compare>::size_type
+SortedList<T, Compare>::count(const_reference value) const
+{
+    return list_.index_of(upper_bound(value)) - list_.index_of(lower_bound(value));
+}
+
+template <typename T, typename Compare>
+typename SortedList<T, Compare>::const_reference
+SortedList<T, Compare>::at(const size_type index) const
+{
+    return list_.at(index);
+}
+
+template <typename T, typename Compare>
+typename SortedList<T, Compare>::size_type
+SortedList<T, Compare>::index_of(const_iterator position) const
+{
+    return list_.index_of(position);
+}
+
+template <typename T, typename Compare>
+typename SortedList<T, Compare>::const_reference
+SortedList<T, Compare>::front() const
+{
+    return list_.front();
+}
+
+template <typename T, typename Compare>
+typename SortedList<T, Compare>::const_reference
+SortedList<T, Compare>::back() const
+{
+    return list_.back();
+}
+
+template <typename T, typename Compare>
+typename SortedList<T, Compare>::size_type
+SortedList<T, Compare>::size() const
+{
+    return list_.size();
+}
+
+template <typename T, typename Compare>
+bool
+SortedList<T, Compare>::empty() const
+{
+    return list_.empty();
+}
+
+template <typename T, typename Compare>
+void
+SortedList<T, Compare>::clear()
+{
+    list_.clear();
+}
+
+template <typename T, typename Compare>
+typename SortedList<T, Compare>::const_iterator
+SortedList<T, Compare>::begin() const
+{
+    return list_.begin();
+}
+
+template <typename T, typename Compare>
+typename SortedList<T, Compare>::const_iterator
+SortedList<T, Compare>::end() const
+{
+    return list_.end();
+}
+
+/// First node not ordered before value (lower) or after it (upper);
+/// the head sentinel stands for end().
+template <typename T, typename Compare>
+typename SortedList<T, Compare>::Node*
+SortedList<T, Compare>::bound(const_reference value, const bool upper) const
+{
+    Node* node = list_.head_;
+    for (size_type level = RankedList<T>::MAX_LEVEL - 1; level > 0; --level) {
+        Node* next = node->levels_[level - 1].next_;
+        while (next != NULL && (upper ? !comparison_(value, next->data_) : comparison_(next->data_, value))) {
+            node = next;
+            next = node->levels_[level - 1].next_;
+        }
+    }
+
+    Node* next = node->next_;
+    while (next != list_.head_ && (upper ? !comparison_(value, next->data_) : comparison_(next->data_, value))) {
+        next = next->next_;
+    }
+    return next;
+}
@@ -0,0 +1,106 @@
+#include "../headers/SpscQueue.hpp"
+#include "../headers/Atomic.hpp"
+#include <cstddef>
+
+template <typename T>
+SpscQueue<T>::SpscQueue()
+    : head_(new Node())
+    , tail_(head_)
+    , first_(head_)
+    , headCopy_(head_)
+{}
+
+/// The reuse cache, the stub and the pending nodes form one chain.
+template <typename T>
+SpscQueue<T>::~SpscQueue()
+{
+    while (first_ != NULL) {
+        Node* next = first_->next_;
+        delete first_;
+        first_ = next;
+    }
+}
+
+/// Producer only.
+template <typename T>
+void
+SpscQueue<T>::push(const_reference value)
+{
+    Node* node = allocate();
+    node->data_ = value;
+    node->previous_ = NULL;
+    node->next_ = NULL;
+    Atomic::store(&tail_->next_, node);
+    tail_ = node;
+}
+
+/// Consumer only.
+template <typename T>
+bool
+SpscQueue<T>::pop(reference value)
+{
+    Node* next = Atomic::load(&head_->next_);
+    if (NULL == next) {
+        return false;
+    }
+    value = next->data_;
+    Atomic::store(&head_, next);
+    return true;
+}
+
+/// Consumer only. Every published node but the newest changes hands as is.
+/// The newest must stay behind as the stub, because the producer may be
+/// about to link after it, so its value is the one element copied.
+template <typename T>
+typename SpscQueue<T>::size_type
+SpscQueue<T>::drain_into(List<T>& list)
+{
+    Node* stub = head_;
+    Node* first = Atomic::load(&stub->next_);
+    if (NULL == first) {
+        return 0;
+    }
+
+    size_type count = 1;
+    Node* last = first;
+    Node* beforeLast = NULL;
+    for (Node* next = Atomic::load(&last->next_); next != NULL; next = Atomic::load(&last->next_), ++count) {
+        next->previous_ = last;
+        beforeLast = last;
+        last = next;
+    }
+
+    if (beforeLast != NULL) {
+        /// the producer reads stub->next_ only after it sees head_ move on
+        stub->next_ = last;
+        list.link(first, beforeLast, list.end_, count - 1);
+    }
+    list.push_back(last->data_);
+    Atomic::store(&head_, last);
+    return count;
+}
+
+/// Consumer only.
+template <typename T>
+bool
+SpscQueue<T>::empty() const
+{
+    return NULL == Atomic::load(&head_->next_);
+}
+
+/// Takes the oldest node the consumer has moved past, refreshing the view of
+/// head_ only when the cached one is used up.
+template <typename T>
+typename SpscQueue<T>::Node*
+SpscQueue<T>::allocate()
+{
+    if (first_ == headCopy_) {
+        headCopy_ = Atomic::load(&head_);
+    }
+    if (first_ != headCopy_) {
+        Node* node = first_;
+        first_ = first_->next_;
+        return node;
+    }
+    return new Node();
+}
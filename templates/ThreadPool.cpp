@@ -0,0 +1,197 @@
+#include "../headers/ThreadPool.hpp"
+#include "../headers/Atomic.hpp"
+#include <cstddef>
+#include <sched.h>
+#include <unistd.h>
+
+/// Zero threads means one per online CPU.
+inline
+ThreadPool::ThreadPool(const size_type threads)
+    : workers_()
+    , starts_()
+    , next_(0)
+    , pending_(0)
+    , stopping_(false)
+{
+    size_type count = threads;
+    if (0 == count) {
+        const long processors = ::sysconf(_SC_NPROCESSORS_ONLN);
+        count = processors > 0 ? static_cast<size_type>(processors) : 1;
+    }
+    ::pthread_mutex_init(&sleep_, NULL);
+    ::pthread_cond_init(&wake_, NULL);
+
+    workers_.resize(count);
+    starts_.resize(count);
+    for (size_type i = 0; i < count; ++i) {
+        workers_[i] = new Worker();
+    }
+    for (size_type i = 0; i < count; ++i) {
+        starts_[i].pool_ = this;
+        starts_[i].index_ = i;
+        ::pthread_create(&workers_[i]->thread_, NULL, start, &starts_[i]);
+    }
+}
+
+/// Runs whatever is still queued, then joins the workers.
+inline
+ThreadPool::~ThreadPool()
+{
+    ::pthread_mutex_lock(&sleep_);
+    stopping_ = true;
+    ::pthread_cond_broadcast(&wake_);
+    ::pthread_mutex_unlock(&sleep_);
+
+    for (size_type i = 0; i < workers_.size(); ++i) {
+        ::pthread_join(workers_[i]->thread_, NULL);
+        delete workers_[i];
+    }
+    ::pthread_cond_destroy(&wake_);
+    ::pthread_mutex_destroy(&sleep_);
+}
+
+/// Process-wide pool, started on first use.
+inline
+ThreadPool&
+ThreadPool::instance()
+{
+    static ThreadPool pool;
+    return pool;
+}
+
+inline
+ThreadPool::size_type
+ThreadPool::size() const
+{
+    return workers_.size();
+}
+
+/// Deals tasks round-robin; idle workers even the load out by stealing.
+inline
+void
+ThreadPool::submit(const Task& task)
+{
+    Atomic::fetchAdd(&pending_, static_cast<size_type>(1));
+    Worker& worker = *workers_[Atomic::fetchAdd(&next_, static_cast<size_type>(1)) % workers_.size()];
+    ::pthread_mutex_lock(&worker.mutex_);
+    worker.tasks_.push_back(task);
+    ::pthread_mutex_unlock(&worker.mutex_);
+
+    ::pthread_mutex_lock(&sleep_);
+    ::pthread_cond_signal(&wake_);
+    ::pthread_mutex_unlock(&sleep_);
+}
+
+/// Own deque from the back, then the others from the front. An index of
+/// size() only steals: that is how threads outside the pool help.
+inline
+bool
+ThreadPool::take(const size_type index, Task& task)
+{
+    const size_type count = workers_.size();
+    if (index < count) {
+        Worker& own = *workers_[index];
+        ::pthread_mutex_lock(&own.mutex_);
+        const bool found = !own.tasks_.empty();
+        if (found) {
+            task = own.tasks_.back();
+            own.tasks_.pop_back();
+        }
+        ::pthread_mutex_unlock(&own.mutex_);
+        if (found) {
+            Atomic::fetchAdd(&pending_, static_cast<size_type>(-1));
+            return true;
+        }
+    }
+    for (size_type step = 1; step <= count; ++step) {
+        Worker& victim = *workers_[(index + step) % count];
+        ::pthread_mutex_lock(&victim.mutex_);
+        const bool found = !victim.tasks_.empty();
+        if (found) {
+            task = victim.tasks_.front();
+            victim.tasks_.pop_front();
+        }
+        ::pthread_mutex_unlock(&victim.mutex_);
+        if (found) {
+            Atomic::fetchAdd(&pending_, static_cast<size_type>(-1));
+            return true;
+        }
+    }
+    return false;
+}
+
+inline
+void
+ThreadPool::execute(const Task& task)
+{
+    task.function_(task.argument_);
+    Atomic::fetchAdd(&task.group_->remaining_, static_cast<size_type>(-1));
+}
+
+inline
+void
+ThreadPool::work(const size_type index)
+{
+    for (;;) {
+        Task task;
+        if (take(index, task)) {
+            execute(task);
+            continue;
+        }
+        ::pthread_mutex_lock(&sleep_);
+        while (0 == Atomic::load(&pending_) && !stopping_) {
+            ::pthread_cond_wait(&wake_, &sleep_);
+        }
+        const bool stop = stopping_ && 0 == Atomic::load(&pending_);
+        ::pthread_mutex_unlock(&sleep_);
+        if (stop) {
+            return;
+        }
+    }
+}
+
+inline
+void*
+ThreadPool::start(void* argument)
+{
+    Start* start = static_cast<Start*>(argument);
+    start->pool_->work(start->index_);
+    return NULL;
+}
+
+///======================================TASK_GROUP==========================================
+
+inline
+ThreadPool::TaskGroup::TaskGroup(ThreadPool& pool)
+    : pool_(pool)
+    , remaining_(0)
+{}
+
+inline
+ThreadPool::TaskGroup::~TaskGroup()
+{
+    wait();
+}
+
+inline
+void
+ThreadPool::TaskGroup::run(Function function, void* argument)
+{
+    Atomic::fetchAdd(&remaining_, static_cast<size_type>(1));
+    pool_.submit(Task(function, argument, this));
+}
+
+/// Helps with queued work, this group's or any other, until the group is done.
+inline
+void
+ThreadPool::TaskGroup::wait()
+{
+    while (Atomic::load(&remaining_) != 0) {
+        Task task;
+        if (pool_.take(pool_.size(), task)) {
+            pool_.execute(task);
+        } else {
+            ::sched_yield();
+        }
+    }
+}